@@ -22,8 +22,11 @@ void setup(void) {
 void loop(void) {
   timer = millis();
 
-  myservo_a.write(myservo_machine_a.pos());
-  myservo_b.write(myservo_machine_b.pos());
+  if (myservo_machine_a.poll()) // Only when there is a new position.
+    myservo_a.write(myservo_machine_a.pos());
+
+  if (myservo_machine_b.poll())
+    myservo_b.write(myservo_machine_b.pos());
 
   myservo_machine_a.begin()
       ->move(90, 5)
@@ -0,0 +1,41 @@
+#include <Group.h>
+#include <PServo.h>
+#include <Servo.h>
+
+#define __SERVO_PIN_A 7
+#define __SERVO_PIN_B 6
+
+unsigned long timer = 0;
+
+ps::PServo myservo_machine_a(&timer);
+Servo myservo_a;
+
+ps::PServo myservo_machine_b(&timer);
+Servo myservo_b;
+
+ps::PServo *const machines[] = {&myservo_machine_a, &myservo_machine_b};
+ps::Group<2> group(machines);
+
+unsigned char const poses[][2] = {{90, 20}, {180, 160}, {0, 90}};
+unsigned char pose = 0;
+
+void setup(void) {
+  myservo_a.attach(__SERVO_PIN_A);
+  myservo_b.attach(__SERVO_PIN_B);
+
+  Serial.begin(9600);
+}
+
+void loop(void) {
+  timer = millis();
+
+  myservo_a.write(myservo_machine_a.pos());
+  myservo_b.write(myservo_machine_b.pos());
+
+  if (not group.is_moving()) { // Both servos arrive together, in 1.5 seconds.
+    group.move(poses[pose], 1500);
+    pose = (pose + 1) % 3;
+  }
+
+  group.tick();
+}
@@ -17,7 +17,8 @@ void setup(void) {
 void loop(void) {
   timer = millis();
 
-  myservo.write(myservo_machine.pos());
+  if (myservo_machine.poll()) // Only when there is a new position.
+    myservo.write(myservo_machine.pos());
 
   myservo_machine.begin()
       ->move(90, 15)
@@ -0,0 +1,38 @@
+#include <PServo.h>
+#include <Servo.h>
+#include <Trace.h>
+
+#define __SERVO_PIN 7
+#define __BAUD_RATE 115200
+
+unsigned long timer = 0;
+
+ps::PServo myservo_machine(&timer, true);
+Servo myservo;
+
+ps::Action const scene[] = {
+    {90, 15},
+    {180, 1500, ps::Profile::SCURVE},
+    {0, 10},
+};
+
+// Save the serial output to a file, then run `./bin/trace --timeline` on it.
+ps::Trace<32> trace;
+ps::StreamSink serial(Serial);
+
+void setup(void) {
+  myservo.attach(__SERVO_PIN);
+  myservo_machine.load(scene, 3);
+
+  Serial.begin(__BAUD_RATE);
+}
+
+void loop(void) {
+  timer = millis();
+
+  myservo.write(myservo_machine.pos());
+  myservo_machine.tick();
+
+  trace.record(timer, 0, myservo_machine); // Every loop, at full speed.
+  trace.flush(serial);
+}
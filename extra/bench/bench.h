@@ -0,0 +1,91 @@
+#pragma once
+
+/*!
+ * Tiny standalone benchmark harness, host only. Each `bench_*.cpp` file
+ * registers its cases with the `BENCH()` macro and `main.cpp` runs all of
+ * them (or only the ones matching the first command line argument).
+ *
+ * A *tick* is one pass of the sketch's `loop()`, i.e. updating every servo in
+ * the fixture once. Results are printed as ns/tick, ns per servo update and
+ * ticks/sec, so regressions can be compared between commits.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace bench {
+typedef void (*Case)(void);
+
+typedef struct Entry {
+  char const *name;
+  Case run;
+} Entry;
+
+/*!
+ * Global list of registered cases, filled before `main()` by the static
+ * `bench::Register` objects that `BENCH()` declares.
+ */
+inline std::vector<Entry> &registry(void) {
+  static std::vector<Entry> entries;
+
+  return entries;
+}
+
+struct Register {
+  Register(char const *name, Case run) { registry().push_back({name, run}); }
+};
+
+/*!
+ * Used to keep the compiler from optimizing the measured loop away, write the
+ * result of the work (positions, counters...) into it.
+ */
+inline unsigned long volatile sink = 0;
+
+/*!
+ * Calls `fn(ticks)` with a growing amount of ticks until a single run takes at
+ * least `min_ms` milliseconds, then returns the measured nanoseconds per tick
+ * of that last run.
+ *
+ * @param fn Callable that performs exactly `ticks` ticks of the fixture.
+ * @param min_ms Minimal wall time of the measured run.
+ *
+ * @returns Average nanoseconds spent on each tick.
+ */
+template <typename F> double measure(F fn, double const min_ms = 100) {
+  using clock = std::chrono::steady_clock;
+
+  for (unsigned long ticks = 1;; ticks *= 2) {
+    clock::time_point const start = clock::now();
+
+    fn(ticks);
+
+    double const ns =
+        std::chrono::duration<double, std::nano>(clock::now() - start).count();
+
+    if (ns >= min_ms * 1e6 or ticks >= (1ul << 30))
+      return ns / ticks;
+  }
+}
+
+/*!
+ * Prints one line of results, in a fixed width format that is easy to diff.
+ *
+ * @param name Name of the measured path.
+ * @param servos Amount of state machines updated on each tick.
+ * @param actions Amount of actions registered on each machine.
+ * @param ns_per_tick Result of `bench::measure()`.
+ */
+inline void report(char const *name, unsigned const servos,
+                   unsigned const actions, double const ns_per_tick) {
+  std::printf("%-24s servos=%-5u actions=%-4u %14.1f ns/tick %10.2f "
+              "ns/update %14.0f ticks/s\n",
+              name, servos, actions, ns_per_tick, ns_per_tick / servos,
+              1e9 / ns_per_tick);
+}
+}; // namespace bench
+
+#define BENCH(name)                                                            \
+  static void bench_##name(void);                                              \
+  static bench::Register const bench_register_##name(#name, bench_##name);     \
+  static void bench_##name(void)
@@ -0,0 +1,64 @@
+#include "bench.h"
+
+#include <thread>
+
+#include "../host/Fleet.h"
+
+namespace {
+unsigned short const MACHINES = 4096;
+unsigned long const VIRTUAL_MS = 10000;
+
+/*!
+ * Simulates `VIRTUAL_MS` milliseconds of a fleet with `MACHINES` machines,
+ * with scenes of very different lengths and speeds, on a given amount of
+ * threads. Reports the servo updates per second of wall time, and how much
+ * faster it was than a single thread.
+ */
+double bench_fleet(unsigned short const threads, double const baseline) {
+  static std::vector<std::vector<ps::Action>> scenes(MACHINES);
+
+  for (unsigned short i = 0; i < MACHINES and scenes[i].empty(); ++i) {
+    for (unsigned short a = 0; a < 1 + i % 31; ++a)
+      scenes[i].push_back({(unsigned char)((i * 37 + a * 71) % 181),
+                           (unsigned short)(1 + (i + a) % 5),
+                           (ps::Profile)((i + a) % 4)});
+  }
+
+  using clock = std::chrono::steady_clock;
+
+  ps::sim::Fleet fleet(threads);
+  std::vector<ps::PServo> machines;
+
+  machines.reserve(MACHINES);
+  fleet.set_tracing(false);
+
+  for (unsigned short i = 0; i < MACHINES; ++i) {
+    machines.emplace_back(fleet.timer(), true);
+    machines.back().load(scenes[i].data(), scenes[i].size());
+    fleet.add(&machines.back());
+  }
+
+  clock::time_point const start = clock::now();
+
+  fleet.run(VIRTUAL_MS);
+
+  double const s =
+      std::chrono::duration<double>(clock::now() - start).count();
+  double const rate = fleet.ticks() / s;
+
+  std::printf("fleet threads=%-3u servos=%-5u %14.0f servo-ticks/s %8.2fx\n",
+              threads, MACHINES, rate, baseline > 0 ? rate / baseline : 1.0);
+
+  bench::sink += fleet.ticks();
+
+  return rate;
+}
+}; // namespace
+
+BENCH(fleet) {
+  unsigned short const cores = std::thread::hardware_concurrency();
+  double const baseline = bench_fleet(1, 0);
+
+  for (unsigned short threads = 2; threads <= 2 * cores; threads *= 2)
+    bench_fleet(threads, baseline);
+}
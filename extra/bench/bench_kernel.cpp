@@ -0,0 +1,47 @@
+#include "bench.h"
+
+#include "../../src/Kernel.h"
+
+namespace {
+template <typename F> void bench_kernel(char const *name, F advance) {
+  for (unsigned short const servos : {16, 64, 1024, 4096}) {
+    std::vector<unsigned char> pos(servos), target(servos), min(servos),
+        max(servos, 180), go(servos);
+    std::vector<unsigned long> pc(servos);
+    std::vector<unsigned short> delay(servos, 1);
+    unsigned long now = 0;
+
+    ps::kernel::Batch const b{
+        .pos = pos.data(),
+        .target = target.data(),
+        .min = min.data(),
+        .max = max.data(),
+        .pc = pc.data(),
+        .delay = delay.data(),
+        .go = go.data(),
+        .count = servos,
+    };
+
+    double const ns = bench::measure([&](unsigned long const ticks) {
+      for (unsigned long t = 0; t < ticks; ++t) {
+        ++now;
+
+        for (unsigned short i = 0; i < servos; ++i) // Keep them all moving.
+          target[i] = pos[i] == 0 ? 180 : pos[i] == 180 ? 0 : target[i];
+
+        advance(b, now);
+        bench::sink += pos[t % servos];
+      }
+    });
+
+    bench::report(name, servos, 1, ns);
+  }
+}
+}; // namespace
+
+BENCH(kernel_advance) {
+  std::printf("vector width: %u\n", ps::kernel::width());
+
+  bench_kernel("kernel_advance", ps::kernel::advance);
+  bench_kernel("kernel_advance_scalar", ps::kernel::advance_scalar);
+}
@@ -0,0 +1,63 @@
+#include "bench.h"
+
+#include <string>
+
+#include "../host/MappedScene.h"
+#include "../host/SceneFile.h"
+
+namespace {
+unsigned long const ACTIONS[] = {1000, 10000, 100000};
+
+/*!
+ * Time to get a machine ready to move (its first action decoded) from a scene
+ * file with `count` actions, by mapping it versus decoding the whole file into
+ * memory first.
+ */
+void bench_mapped(unsigned long const count) {
+  std::string const path = "/tmp/pservo_bench_" + std::to_string(count);
+  std::vector<ps::Action> scene;
+
+  for (unsigned long i = 0; i < count; ++i)
+    scene.push_back({(unsigned char)(i % 181), (unsigned short)(5 + i % 46)});
+
+  if (not ps::binary::save(path.c_str(), scene.data(), scene.size()))
+    return;
+
+  unsigned long timer = 0;
+
+  double const mapped_ns = bench::measure([&](unsigned long const ticks) {
+    for (unsigned long t = 0; t < ticks; ++t) {
+      ps::binary::MappedScene mapped(path.c_str());
+      ps::MemorySource bytes = mapped.bytes();
+      ps::ScenePlayer player(&bytes);
+      ps::PServo machine(&timer);
+
+      bench::sink += machine.play(&player)->props().delay;
+    }
+  });
+
+  double const decoded_ns = bench::measure([&](unsigned long const ticks) {
+    for (unsigned long t = 0; t < ticks; ++t) {
+      ps::binary::FileSource file(path.c_str());
+      ps::ScenePlayer player(&file);
+      std::vector<ps::Action> actions;
+
+      for (ps::Action action; player.next(&action);)
+        actions.push_back(action);
+
+      bench::sink += actions.size();
+    }
+  });
+
+  std::printf("mapped_load actions=%-7lu %12.1f ns mapped %14.1f ns decoded "
+              "%10.1fx faster\n",
+              count, mapped_ns, decoded_ns, decoded_ns / mapped_ns);
+
+  std::remove(path.c_str());
+}
+}; // namespace
+
+BENCH(mapped_load) {
+  for (unsigned long const count : ACTIONS)
+    bench_mapped(count);
+}
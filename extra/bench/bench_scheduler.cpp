@@ -0,0 +1,76 @@
+#include "bench.h"
+
+#include "../../src/Scheduler.h"
+
+namespace {
+unsigned long const VIRTUAL_MS = 10000;
+
+/*!
+ * Simulates `VIRTUAL_MS` milliseconds of a 1 kHz `loop()` with `N` machines,
+ * with realistic delays (5~50 ms per degree), both polling every machine and
+ * using the scheduler. Reports the CPU time spent on each virtual second, how
+ * much of it the scheduler saved, how many updates were actually needed and
+ * how much of the loops had nothing at all to do (idle).
+ */
+template <unsigned short N> void bench_scheduler(void) {
+  static ps::Action scenes[N][2];
+  static unsigned long timer = 0;
+  static ps::Scheduler<N> scheduler(&timer);
+  std::vector<ps::PServo> polled, scheduled;
+
+  polled.reserve(N);
+  scheduled.reserve(N);
+
+  for (unsigned short i = 0; i < N; ++i) {
+    scenes[i][0] = {180, (unsigned short)(5 + i * 7 % 46)};
+    scenes[i][1] = {0, (unsigned short)(5 + i * 13 % 46)};
+
+    polled.emplace_back(&timer, true);
+    polled.back().load(scenes[i], 2);
+    scheduled.emplace_back(&timer, true);
+    scheduled.back().load(scenes[i], 2);
+  }
+
+  for (ps::PServo &m : scheduled)
+    scheduler.add(&m);
+
+  unsigned long updates = 0;
+  unsigned long idle = 0;
+
+  double const polled_ns = bench::measure(
+      [&](unsigned long const) {
+        for (timer = 0; timer < VIRTUAL_MS; ++timer) {
+          for (ps::PServo &m : polled)
+            bench::sink += m.tick()->pos();
+        }
+      },
+      0);
+
+  double const scheduled_ns = bench::measure(
+      [&](unsigned long const) {
+        for (timer = 0; timer < VIRTUAL_MS; ++timer) {
+          unsigned short const ticked = scheduler.run();
+
+          updates += ticked;
+          idle += ticked == 0;
+        }
+      },
+      0);
+
+  std::printf("scheduler servos=%-5u %10.1f us/s polled %10.1f us/s "
+              "scheduled %6.2f%% cpu saved %6.2f%% updates %6.2f%% idle "
+              "loops\n",
+              N, polled_ns / 1e3 * 1000 / VIRTUAL_MS,
+              scheduled_ns / 1e3 * 1000 / VIRTUAL_MS,
+              100.0 * (1 - scheduled_ns / polled_ns),
+              100.0 * updates / ((double)N * VIRTUAL_MS),
+              100.0 * idle / VIRTUAL_MS);
+}
+}; // namespace
+
+BENCH(scheduler) {
+  bench_scheduler<1>();
+  bench_scheduler<8>();
+  bench_scheduler<64>();
+  bench_scheduler<1024>();
+}
@@ -0,0 +1,115 @@
+#include "bench.h"
+
+#include "../../src/PServo.h"
+#include "../../src/ServoBank.h"
+
+namespace {
+unsigned const SERVOS[] = {1, 8, 64, 1024};
+unsigned const ACTIONS[] = {2, 16, 255};
+
+/*!
+ * Targets used by the fixture scenes, it keeps bouncing between the edges so
+ * every action has something to do before the next one starts.
+ */
+inline unsigned char target(unsigned const action) {
+  return action % 2 == 0 ? 180 : 0;
+}
+}; // namespace
+
+BENCH(chained_begin_move) {
+  for (unsigned const servos : SERVOS) {
+    for (unsigned const actions : ACTIONS) {
+      unsigned long timer = 0;
+      std::vector<ps::PServo> machines;
+
+      machines.reserve(servos);
+
+      for (unsigned i = 0; i < servos; ++i)
+        machines.emplace_back(&timer, true);
+
+      double const ns = bench::measure([&](unsigned long const ticks) {
+        for (unsigned long t = 0; t < ticks; ++t) {
+          ++timer;
+
+          for (ps::PServo &m : machines) {
+            m.begin();
+
+            for (unsigned a = 0; a < actions; ++a)
+              m.move(target(a), 1);
+
+            bench::sink += m.pos();
+          }
+        }
+      });
+
+      bench::report("chained_begin_move", servos, actions, ns);
+    }
+  }
+}
+
+BENCH(compiled_tick) {
+  for (unsigned const servos : SERVOS) {
+    for (unsigned const actions : ACTIONS) {
+      unsigned long timer = 0;
+      std::vector<ps::Action> scene;
+      std::vector<ps::PServo> machines;
+
+      for (unsigned a = 0; a < actions; ++a)
+        scene.push_back({target(a), 1});
+
+      machines.reserve(servos);
+
+      for (unsigned i = 0; i < servos; ++i) {
+        machines.emplace_back(&timer, true);
+        machines.back().load(scene.data(), actions);
+      }
+
+      double const ns = bench::measure([&](unsigned long const ticks) {
+        for (unsigned long t = 0; t < ticks; ++t) {
+          ++timer;
+
+          for (ps::PServo &m : machines)
+            bench::sink += m.tick()->pos();
+        }
+      });
+
+      bench::report("compiled_tick", servos, actions, ns);
+    }
+  }
+}
+
+template <unsigned short N> static void bench_bank(unsigned const actions) {
+  // Both static, the bank is too big for the stack and keeps a pointer to the
+  // timer across the calls.
+  static unsigned long timer = 0;
+  static ps::ServoBank<N> bank(&timer);
+  std::vector<ps::Action> scene;
+
+  for (unsigned a = 0; a < actions; ++a)
+    scene.push_back({target(a), 1});
+
+  for (unsigned short i = 0; i < N; ++i) {
+    bank.configure(i, ps::Default::MIN, ps::Default::MAX, true);
+    bank.load(i, scene.data(), actions);
+  }
+
+  double const ns = bench::measure([&](unsigned long const ticks) {
+    for (unsigned long t = 0; t < ticks; ++t) {
+      ++timer;
+
+      bank.tick();
+      bench::sink += bank.pos(t % N);
+    }
+  });
+
+  bench::report("servo_bank", N, actions, ns);
+}
+
+BENCH(servo_bank) {
+  for (unsigned const actions : ACTIONS) {
+    bench_bank<1>(actions);
+    bench_bank<8>(actions);
+    bench_bank<64>(actions);
+    bench_bank<1024>(actions);
+  }
+}
@@ -0,0 +1,17 @@
+#include <cstring>
+
+#include "bench.h"
+
+int main(int argc, char *argv[]) {
+  char const *const filter = argc > 1 ? argv[1] : "";
+
+  for (bench::Entry const &e : bench::registry()) {
+    if (std::strstr(e.name, filter) == nullptr)
+      continue;
+
+    std::printf("# %s\n", e.name);
+    e.run();
+  }
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "../../src/ServoBank.h"
+
+TEST(Bank, should_start_with_the_default_props) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  ServoBank<4> bank(&timer);
+
+  for (unsigned short i = 0; i < bank.size(); ++i) {
+    Props const p = bank.props(i);
+
+    EXPECT_EQ(p.state, State::STANDBY);
+    EXPECT_EQ(p.timer, &timer);
+    EXPECT_EQ(p.min, Default::MIN);
+    EXPECT_EQ(p.max, Default::MAX);
+    EXPECT_FALSE(p.is_resetable);
+    EXPECT_EQ(p.actions_count, 0);
+    EXPECT_EQ(p.pos, 0);
+  }
+}
+
+TEST(Bank, should_mirror_independent_machines_on_every_loop) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const wave[] = {{5, 3}, {5, 1}, {0, 2}, {12, 0}, {3, 4}};
+  Action const nod[] = {{30, 1}, {20, 2}};
+  Action const clamped[] = {{200, 1}, {0, 1}};
+
+  ServoBank<3> bank(&timer);
+
+  PServo machines[] = {
+      PServo(&timer, 0, 180, true),
+      PServo(&timer, 10, 25, false),
+      PServo(&timer, 0, 180, false),
+  };
+
+  bank.configure(0, 0, 180, true);
+  bank.configure(1, 10, 25, false);
+  bank.load(0, wave, 5);
+  bank.load(1, nod, 2);
+  bank.load(2, clamped, 2);
+
+  machines[0].load(wave, 5);
+  machines[1].load(nod, 2);
+  machines[2].load(clamped, 2);
+
+  for (unsigned short loop = 0; loop < 1000; ++loop) {
+    timer += loop % 3;
+
+    bank.tick();
+
+    for (unsigned short i = 0; i < 3; ++i) {
+      machines[i].tick();
+
+      ASSERT_EQ(bank.get_state(i), machines[i].get_state()) << "servo " << i;
+      ASSERT_EQ(bank.pos(i), machines[i].pos()) << "servo " << i;
+      ASSERT_EQ(bank.props(i).pc, machines[i].props().pc) << "servo " << i;
+      ASSERT_EQ(bank.props(i).active_action,
+                machines[i].props().active_action)
+          << "servo " << i;
+    }
+  }
+}
+
+TEST(Bank, should_start_over_after_a_reset) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{2, 1}, {0, 1}};
+
+  ServoBank<1> bank(&timer);
+
+  bank.load(0, scene, 2);
+
+  while (not bank.is_state(0, State::HALT)) {
+    ++timer;
+    bank.tick();
+  }
+
+  bank.reset(0);
+  ASSERT_EQ(bank.get_state(0), State::IN_ACTION);
+  ASSERT_EQ(bank.props(0).active_action, 0);
+}
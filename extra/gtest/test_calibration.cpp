@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+#include "../host/FakeClock.h"
+
+TEST(Calibration, should_match_the_linear_profile) {
+  using namespace ps;
+
+  Calibration const points[] = {{0, 544}, {180, 2400}};
+  unsigned short pulses[Default::MAX + 1];
+
+  ASSERT_TRUE(calibrate(points, 2, pulses));
+
+  ServoProfile const linear = {0, 180, 1, 544, 2400, nullptr};
+  ServoProfile const table = {0, 180, 1, 544, 2400, pulses};
+  sim::FakeClock clock;
+
+  PServo a(clock, linear);
+  PServo b(clock, table);
+
+  for (clock.set(0); clock.now() <= 200; clock.advance(1)) {
+    a.begin(1)->move(180);
+    b.begin(1)->move(180);
+
+    ASSERT_EQ(b.pos_us(), a.pos_us()) << "at " << (int)a.pos();
+  }
+}
+
+TEST(Calibration, should_follow_the_measured_points) {
+  using namespace ps;
+
+  Calibration const points[] = {{0, 520}, {90, 1430}, {135, 1950}, {180, 2390}};
+  unsigned short pulses[Default::MAX + 1];
+
+  ASSERT_TRUE(calibrate(points, 4, pulses));
+
+  ASSERT_EQ(pulses[0], 520);
+  ASSERT_EQ(pulses[45], 975);
+  ASSERT_EQ(pulses[90], 1430);
+  ASSERT_EQ(pulses[135], 1950);
+  ASSERT_EQ(pulses[180], 2390);
+
+  for (unsigned char i = 1; i <= Default::MAX; ++i)
+    ASSERT_GT(pulses[i], pulses[i - 1]) << "at " << (int)i;
+}
+
+TEST(Calibration, should_reject_invalid_points) {
+  using namespace ps;
+
+  Calibration const short_range[] = {{0, 500}, {170, 2400}};
+  Calibration const unsorted[] = {{0, 500}, {100, 1500}, {90, 1400},
+                                  {180, 2400}};
+  unsigned short pulses[Default::MAX + 1] = {};
+
+  ASSERT_FALSE(calibrate(short_range, 2, pulses));
+  ASSERT_FALSE(calibrate(unsorted, 4, pulses));
+  ASSERT_FALSE(calibrate(short_range, 1, pulses));
+  ASSERT_FALSE(calibrate(nullptr, 2, pulses));
+  ASSERT_FALSE(calibrate(short_range, 2, nullptr));
+
+  for (unsigned short const pulse : pulses)
+    ASSERT_EQ(pulse, 0);
+}
+
+TEST(Calibration, should_interpolate_in_high_resolution) {
+  using namespace ps;
+
+  // Mounted upside down.
+  Calibration const reversed[] = {{0, 2400}, {180, 600}};
+  unsigned short pulses[Default::MAX + 1];
+
+  ASSERT_TRUE(calibrate(reversed, 2, pulses));
+
+  ServoProfile const profile = {0, 180, 1, 600, 2400, pulses};
+  sim::FakeClock clock;
+
+  PServo pservo(clock, profile);
+
+  pservo.set_high_res(true);
+
+  for (clock.set(0); clock.now() <= 200; clock.advance(1)) {
+    pservo.begin(1)->sweep(10, 200, Profile::LINEAR);
+
+    unsigned short const at = pulses[pservo.pos()];
+
+    ASSERT_LE(pservo.pos_us(), at) << "at " << clock.now();
+    ASSERT_GT(pservo.pos_us(), at - 10) << "at " << clock.now();
+  }
+
+  ASSERT_EQ(pservo.pos_us(), 2300);
+}
+
+TEST(Calibration, should_be_updated_at_runtime) {
+  using namespace ps;
+
+  Calibration const before[] = {{0, 500}, {180, 2500}};
+  Calibration const after[] = {{0, 500}, {90, 1400}, {180, 2500}};
+  unsigned short pulses[Default::MAX + 1];
+
+  calibrate(before, 2, pulses);
+
+  ServoProfile const profile = {0, 180, 1, 500, 2500, pulses};
+  sim::FakeClock clock;
+
+  PServo pservo(clock, profile);
+
+  for (clock.set(0); clock.now() <= 100; clock.advance(1))
+    pservo.begin(1)->move(90);
+
+  ASSERT_EQ(pservo.pos_us(), 1500);
+
+  calibrate(after, 3, pulses);
+
+  ASSERT_EQ(pservo.pos_us(), 1400);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+
+TEST(CatchUp, should_be_disabled_by_default) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  ASSERT_FALSE(pservo.props().is_catching_up);
+
+  pservo.begin()->move(90, 2);
+  pservo.begin()->move(90, 2);
+
+  timer += 10; // Five delays have passed, but only one degree is stepped.
+
+  pservo.begin()->move(90, 2);
+  ASSERT_EQ(pservo.pos(), 1);
+}
+
+TEST(CatchUp, should_step_one_degree_for_each_delay_that_passed) {
+  using namespace ps;
+
+  unsigned long timer = 1000; // Started long after the board booted up.
+
+  PServo pservo(&timer);
+
+  pservo.set_catch_up(true);
+  ASSERT_TRUE(pservo.props().is_catching_up);
+
+  pservo.begin()->move(90, 2);
+  pservo.begin()->move(90, 2);
+  ASSERT_EQ(pservo.pos(), 0);
+
+  timer += 11; // Five delays and a leftover.
+
+  pservo.begin()->move(90, 2);
+  ASSERT_EQ(pservo.pos(), 5);
+  ASSERT_EQ(pservo.props().pc, 1010);
+
+  timer += 1; // The leftover completes another delay.
+
+  pservo.begin()->move(90, 2);
+  ASSERT_EQ(pservo.pos(), 6);
+}
+
+TEST(CatchUp, should_not_go_further_than_the_target_nor_the_limits) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, 0, 20, false);
+
+  pservo.set_catch_up(true);
+
+  pservo.begin()->move(10, 1)->move(40, 1);
+  pservo.begin()->move(10, 1)->move(40, 1);
+
+  timer += 100;
+
+  pservo.begin()->move(10, 1)->move(40, 1);
+  ASSERT_EQ(pservo.pos(), 10);
+  ASSERT_EQ(pservo.props().pc, 10); // The time after the target is kept.
+
+  pservo.begin()->move(10, 1)->move(40, 1);
+  ASSERT_EQ(pservo.props().active_action, 1);
+  ASSERT_EQ(pservo.pos(), 20);
+}
+
+TEST(CatchUp, should_keep_the_real_time_speed_with_a_slow_loop) {
+  using namespace ps;
+
+  unsigned long const LOOP_PERIODS[] = {1, 3, 7, 25};
+
+  for (unsigned long const period : LOOP_PERIODS) {
+    unsigned long timer = 0;
+
+    PServo pservo(&timer);
+
+    pservo.set_catch_up(true);
+    pservo.begin()->move(90, 2)->move(30, 3);
+
+    while (not pservo.is_state(State::HALT)) {
+      timer += period;
+      pservo.begin()->move(90, 2)->move(30, 3);
+    }
+
+    // 90 * 2 + 60 * 3 time units, plus the loop that does the last step and
+    // the ones that notices the end of each action.
+    EXPECT_LE(timer, 360 + 3 * period) << "loop period " << period;
+    EXPECT_EQ(pservo.pos(), 30);
+  }
+}
+
+TEST(CatchUp, should_not_overflow_the_steps_of_long_delays) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.set_catch_up(true);
+
+  pservo.begin()->move(180, 1000); // Microseconds, like with `micros()`.
+  pservo.begin()->move(180, 1000);
+
+  timer += 100500; // 100 delays, that's 100000 past the 16 bits limit.
+
+  pservo.begin()->move(180, 1000);
+  ASSERT_EQ(pservo.pos(), 100);
+  ASSERT_EQ(pservo.props().pc, 100000);
+
+  timer += 500;
+
+  pservo.begin()->move(180, 1000);
+  ASSERT_EQ(pservo.pos(), 101);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../../src/Scheduler.h"
+#include "../host/FakeClock.h"
+
+namespace {
+unsigned long board_time = 0;
+
+unsigned long fake_millis(void) { return board_time; }
+
+// Counts how many times the machine asked for the time.
+class CountingClock : public ps::Clock {
+public:
+  unsigned long now(void) const override {
+    ++reads;
+    return time;
+  }
+
+  unsigned long time = 0;
+  mutable unsigned long reads = 0;
+};
+}; // namespace
+
+TEST(Clock, should_move_just_like_the_timer_pointer) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  sim::FakeClock clock;
+
+  PServo pointed(&timer, 10, 170, false);
+  PServo clocked(clock, 10, 170, false);
+
+  for (timer = 0; timer < 500; ++timer, clock.advance(1)) {
+    pointed.begin()->move(90, 2)->sweep(20, 100, Profile::SCURVE);
+    clocked.begin()->move(90, 2)->sweep(20, 100, Profile::SCURVE);
+
+    ASSERT_EQ(clocked.pos(), pointed.pos()) << "at " << timer;
+    ASSERT_EQ(clocked.get_state(), pointed.get_state()) << "at " << timer;
+  }
+
+  ASSERT_EQ(clocked.props().timer, nullptr);
+  ASSERT_EQ(clocked.props().clock, &clock);
+}
+
+TEST(Clock, should_never_complain_about_the_timer) {
+  using namespace ps;
+
+  Action const scene[] = {{3, 1}};
+  sim::FakeClock clock;
+
+  PServo chained(clock);
+  PServo loaded(clock);
+
+  for (unsigned char i = 0; i < 10; ++i, clock.advance(1)) {
+    chained.begin()->move(3);
+    loaded.load(scene, 1)->tick();
+
+    ASSERT_NE(chained.get_state(), State::ERROR_TIMERPTR);
+    ASSERT_NE(loaded.get_state(), State::ERROR_TIMERPTR);
+  }
+}
+
+TEST(Clock, should_read_the_time_only_when_needed) {
+  using namespace ps;
+
+  FunctionClock<fake_millis> clock;
+  Action const scene[] = {{2, 10}};
+
+  PServo pservo(clock);
+
+  board_time = 0;
+  pservo.load(scene, 1);
+
+  board_time = 10; // Nothing else to update, the machine reads it by itself.
+  pservo.tick();
+  ASSERT_EQ(pservo.pos(), 1);
+  ASSERT_EQ(pservo.props().pc, 10);
+}
+
+TEST(Clock, should_read_the_time_once_per_update) {
+  using namespace ps;
+
+  // Each one ends right away, so a single update performs all of them.
+  Action const scene[] = {{0, 5}, {0, 5}, {0, 5}, {4, 1}};
+  CountingClock clock;
+
+  PServo pservo(clock);
+
+  pservo.load(scene, 4);
+
+  for (unsigned char i = 0; i < 10; ++i, ++clock.time) {
+    clock.reads = 0;
+    pservo.tick();
+
+    ASSERT_EQ(clock.reads, 1) << "update " << (int)i;
+  }
+
+  ASSERT_EQ(pservo.pos(), 4);
+}
+
+TEST(Clock, should_read_a_counter_updated_by_someone_else) {
+  using namespace ps;
+
+  unsigned long volatile counter = 0;
+  std::atomic<bool> is_done(false);
+
+  AtomicClock clock(counter);
+  PServo pservo(clock);
+
+  std::thread interrupt([&] {
+    while (not is_done) {
+      __atomic_fetch_add(&counter, 1, __ATOMIC_RELEASE);
+      std::this_thread::yield();
+    }
+  });
+
+  while (pservo.pos() < 50)
+    pservo.begin()->move(50, 3);
+
+  is_done = true;
+  interrupt.join();
+
+  ASSERT_GE(clock.now(), 50 * 3);
+}
+
+TEST(Clock, should_schedule_with_a_clock) {
+  using namespace ps;
+
+  Action const scene[] = {{10, 12}};
+  sim::FakeClock clock;
+
+  PServo pservo(clock);
+  Scheduler<1> scheduler(clock);
+
+  pservo.load(scene, 1);
+
+  ASSERT_TRUE(scheduler.add(&pservo));
+  ASSERT_EQ(scheduler.until_next(), 12);
+
+  clock.set(12);
+  ASSERT_EQ(scheduler.run(), 1);
+  ASSERT_EQ(pservo.pos(), 1);
+}
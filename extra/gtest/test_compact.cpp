@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "../../src/CompactServo.h"
+
+TEST(Compact, should_fit_the_memory_budget) {
+  using namespace ps;
+
+  // A pointer to the scene, plus 6 bytes of state (8 bytes on AVR boards).
+  ASSERT_LE(sizeof(CompactServo), sizeof(void *) + 8);
+  ASSERT_LE(sizeof(CompactServo) * 2, sizeof(PServo));
+}
+
+TEST(Compact, should_move_just_like_the_normal_machine) {
+  using namespace ps;
+
+  Action const scene[] = {{90, 3}, {200, 1}, {10, 0}, {10, 7}, {45, 2}};
+
+  for (bool const is_resetable : {false, true}) {
+    unsigned long timer = 1000;
+
+    Rig const rig = {&timer, 10, 170};
+    PServo pservo(&timer, 10, 170, is_resetable);
+    CompactServo compact(is_resetable);
+
+    Action const loop[] = {{170, 3}, {10, 2}, {45, 5}};
+
+    pservo.load(loop, 3);
+    compact.load(loop, 3);
+
+    for (; timer < 3000; ++timer) {
+      pservo.tick();
+      compact.tick(rig);
+
+      ASSERT_EQ(compact.pos(), pservo.pos()) << "at " << timer;
+      ASSERT_EQ(compact.get_state(), pservo.get_state()) << "at " << timer;
+      ASSERT_EQ(compact.active_action(), pservo.props().active_action);
+    }
+
+    ASSERT_EQ(compact.is_state(State::HALT), not is_resetable);
+
+    // Out of the limits, so it never gets to the second action.
+    pservo.load(scene, 5);
+    compact.load(scene, 5);
+
+    for (timer = 5000; timer < 6000; ++timer) {
+      pservo.tick();
+      compact.tick(rig);
+
+      ASSERT_EQ(compact.pos(), pservo.pos()) << "at " << timer;
+      ASSERT_EQ(compact.active_action(), pservo.props().active_action);
+    }
+  }
+}
+
+TEST(Compact, should_keep_the_delay_across_the_16_bits_wrap) {
+  using namespace ps;
+
+  Action const scene[] = {{180, 1000}};
+
+  unsigned long timer = 0xFFFFFFFF - 5 * 65536;
+
+  Rig const rig = {&timer, 0, 180};
+  CompactServo compact;
+
+  compact.load(scene, 1);
+
+  for (unsigned long i = 0; i < 180000; ++i, ++timer) {
+    compact.tick(rig);
+
+    ASSERT_EQ(compact.pos(), 1 + i / 1000) << "after " << i;
+  }
+
+  ASSERT_TRUE(compact.is_state(State::HALT));
+}
+
+TEST(Compact, should_handle_the_states) {
+  using namespace ps;
+
+  Action const scene[] = {{2, 1}};
+
+  unsigned long timer = 0;
+
+  Rig const rig = {&timer, 0, 180};
+  Rig const broken = {nullptr, 0, 180};
+  CompactServo compact;
+
+  ASSERT_TRUE(compact.is_state(State::STANDBY));
+  ASSERT_TRUE(compact.load(nullptr, 3)->is_state(State::ERROR_NOACTION));
+  ASSERT_TRUE(compact.load(scene, 0)->is_state(State::ERROR_NOACTION));
+  ASSERT_TRUE(compact.load(scene, 1)->tick(broken)->is_state(
+      State::ERROR_TIMERPTR));
+
+  compact.load(scene, 1);
+
+  for (timer = 0; timer < 10; ++timer)
+    compact.tick(rig);
+
+  ASSERT_TRUE(compact.is_state(State::HALT));
+  ASSERT_EQ(compact.pos(), 2);
+
+  compact.reset();
+
+  ASSERT_TRUE(compact.is_state(State::IN_ACTION));
+  ASSERT_EQ(compact.active_action(), 0);
+}
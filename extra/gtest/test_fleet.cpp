@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include "../host/Fleet.h"
+
+namespace {
+unsigned short const MACHINES = 1000;
+
+// Scenes with very different lengths, so the chunks are uneven.
+std::vector<std::vector<ps::Action>> scenes(void) {
+  std::vector<std::vector<ps::Action>> all(MACHINES);
+
+  for (unsigned short i = 0; i < MACHINES; ++i) {
+    for (unsigned short a = 0; a < 1 + i % 13; ++a)
+      all[i].push_back({(unsigned char)((i * 37 + a * 71) % 181),
+                        (unsigned short)(1 + (i + a) % 9),
+                        (ps::Profile)((i + a) % 4)});
+  }
+
+  return all;
+}
+
+template <typename Runner>
+void fill(Runner &runner, std::vector<ps::PServo> &machines,
+          std::vector<std::vector<ps::Action>> const &all) {
+  machines.reserve(MACHINES);
+
+  for (unsigned short i = 0; i < MACHINES; ++i) {
+    machines.emplace_back(runner.timer(), i % 5 == 0);
+    machines.back().load(all[i].data(), all[i].size());
+    runner.add(&machines.back());
+  }
+}
+}; // namespace
+
+TEST(Fleet, should_give_the_same_traces_as_a_single_thread) {
+  using namespace ps;
+
+  std::vector<std::vector<Action>> const all = scenes();
+  std::vector<PServo> single_machines, fleet_machines;
+
+  sim::Engine engine;
+  sim::Fleet fleet(4);
+
+  fill(engine, single_machines, all);
+  fill(fleet, fleet_machines, all);
+
+  ASSERT_EQ(fleet.threads(), 4);
+  ASSERT_EQ(fleet.next(), engine.next());
+
+  ASSERT_EQ(fleet.run(10000), engine.run(10000));
+  ASSERT_EQ(fleet.ticks(), engine.ticks());
+  ASSERT_EQ(fleet.trace().size(), engine.trace().size());
+
+  std::vector<std::vector<sim::Sample>> traces(MACHINES);
+
+  for (sim::Sample const &s : engine.trace())
+    traces[s.id].push_back(s);
+
+  for (unsigned short i = 0; i < MACHINES; ++i) {
+    std::vector<sim::Sample> const &expected = traces[i];
+    std::vector<sim::Sample> const &actual = fleet.trace(i);
+
+    ASSERT_EQ(actual.size(), expected.size()) << "machine " << i;
+
+    for (unsigned long s = 0; s < expected.size(); ++s) {
+      ASSERT_EQ(actual[s].time, expected[s].time) << "machine " << i;
+      ASSERT_EQ(actual[s].pos, expected[s].pos) << "machine " << i;
+    }
+
+    ASSERT_EQ(fleet_machines[i].get_state(), single_machines[i].get_state());
+  }
+}
+
+TEST(Fleet, should_not_depend_on_the_amount_of_threads) {
+  using namespace ps;
+
+  std::vector<std::vector<Action>> const all = scenes();
+  std::vector<PServo> one_machines, many_machines;
+
+  sim::Fleet one(1);
+  sim::Fleet many(7);
+
+  fill(one, one_machines, all);
+  fill(many, many_machines, all);
+
+  one.run(5000);
+  many.run(5000);
+
+  std::vector<sim::Sample> const expected = one.trace();
+  std::vector<sim::Sample> const actual = many.trace();
+
+  ASSERT_EQ(actual.size(), expected.size());
+
+  for (unsigned long s = 0; s < expected.size(); ++s) {
+    ASSERT_EQ(actual[s].time, expected[s].time) << "sample " << s;
+    ASSERT_EQ(actual[s].id, expected[s].id) << "sample " << s;
+    ASSERT_EQ(actual[s].pos, expected[s].pos) << "sample " << s;
+  }
+}
+
+TEST(Fleet, should_stop_when_every_machine_is_done) {
+  using namespace ps;
+
+  Action const wave[] = {{10, 2}, {0, 2}};
+
+  sim::Fleet fleet(3);
+  std::vector<PServo> machines(10, PServo(fleet.timer()));
+
+  for (PServo &m : machines) {
+    m.load(wave, 2);
+    fleet.add(&m);
+  }
+
+  ASSERT_EQ(fleet.run(), 41);
+  ASSERT_EQ(fleet.next(), sim::Fleet::NEVER);
+  ASSERT_EQ(fleet.step(), 0);
+
+  for (PServo const &m : machines)
+    ASSERT_TRUE(m.is_state(State::HALT));
+}
+
+TEST(Fleet, should_run_across_the_wrap_point) {
+  using namespace ps;
+
+  unsigned long const START = 0xFFFFFC00; // 1024 units before the wrap.
+
+  std::vector<std::vector<Action>> const all = scenes();
+  std::vector<PServo> single_machines, fleet_machines;
+
+  sim::Engine engine(START);
+  sim::Fleet fleet(4, START);
+
+  single_machines.reserve(MACHINES);
+  fleet_machines.reserve(MACHINES);
+
+  for (unsigned short i = 0; i < MACHINES; ++i) {
+    single_machines.emplace_back(engine.timer());
+    fleet_machines.emplace_back(fleet.timer());
+
+    single_machines.back().load(all[i].data(), all[i].size());
+    fleet_machines.back().load(all[i].data(), all[i].size());
+
+    // Started on the first update, so the deadlines are not from the time 0.
+    engine.add(single_machines.back().tick());
+    fleet.add(fleet_machines.back().tick());
+  }
+
+  ASSERT_EQ(fleet.run(), engine.run());
+  ASSERT_LT(fleet.now(), START); // It really went through the wrap point.
+
+  std::vector<sim::Sample> const expected = engine.trace();
+  std::vector<sim::Sample> const actual = fleet.trace();
+
+  ASSERT_EQ(actual.size(), expected.size());
+
+  for (unsigned long s = 0; s < expected.size(); ++s) {
+    ASSERT_EQ(actual[s].time, expected[s].time) << "sample " << s;
+    ASSERT_EQ(actual[s].id, expected[s].id) << "sample " << s;
+    ASSERT_EQ(actual[s].pos, expected[s].pos) << "sample " << s;
+  }
+}
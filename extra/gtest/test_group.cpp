@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "../../src/Group.h"
+#include "../host/FakeClock.h"
+
+TEST(Group, should_step_a_linear_sweep_at_exact_rates) {
+  using namespace ps;
+
+  unsigned short const DURATIONS[] = {1, 7, 180, 1000, 4099, 65535};
+  unsigned char const TARGETS[] = {1, 3, 90, 179, 180};
+
+  for (unsigned short const duration : DURATIONS) {
+    for (unsigned char const target : TARGETS) {
+      sim::FakeClock clock(42);
+
+      PServo pservo(clock);
+
+      pservo.begin(1)->sweep(target, duration, Profile::LINEAR);
+
+      for (unsigned long t = 0; t < duration; t += 1 + duration / 500) {
+        clock.set(42 + t);
+        pservo.begin(1)->sweep(target, duration, Profile::LINEAR);
+
+        ASSERT_EQ(pservo.pos(), (unsigned long)target * t / duration)
+            << "to " << (int)target << " in " << duration << " at " << t;
+      }
+
+      clock.set(42 + duration);
+      pservo.begin(1)->sweep(target, duration, Profile::LINEAR);
+      ASSERT_EQ(pservo.pos(), target);
+    }
+  }
+}
+
+TEST(Group, should_arrive_together) {
+  using namespace ps;
+
+  sim::FakeClock clock;
+
+  PServo a(clock);
+  PServo b(clock);
+  PServo c(clock, 0, 100, false);
+
+  PServo *const machines[] = {&a, &b, &c};
+  Group<3> group(machines);
+
+  unsigned char const targets[] = {180, 7, 150}; // 150 is out of c limits.
+
+  ASSERT_FALSE(group.is_moving());
+  ASSERT_EQ(group.size(), 3);
+
+  group.move(targets, 900);
+
+  for (clock.set(0); clock.now() < 900; clock.advance(1)) {
+    group.tick();
+
+    ASSERT_LT(a.pos(), 180) << "at " << clock.now();
+    ASSERT_LT(b.pos(), 7) << "at " << clock.now();
+    ASSERT_LT(c.pos(), 100) << "at " << clock.now();
+  }
+
+  group.tick();
+
+  ASSERT_EQ(a.pos(), 180);
+  ASSERT_EQ(b.pos(), 7);
+  ASSERT_EQ(group[2].pos(), 100);
+  ASSERT_TRUE(group.is_moving()); // It will notice on the next update.
+
+  clock.advance(1);
+  group.tick();
+  ASSERT_FALSE(group.is_moving());
+}
+
+TEST(Group, should_start_the_next_move_from_where_it_stopped) {
+  using namespace ps;
+
+  sim::FakeClock clock;
+
+  PServo a(clock);
+  PServo b(clock);
+
+  PServo *const machines[] = {&a, &b};
+  Group<2> group(machines);
+
+  unsigned char const first[] = {100, 40};
+  unsigned char const second[] = {40, 40}; // The second axis holds.
+
+  group.move(first, 200);
+
+  while (group.is_moving()) {
+    group.tick();
+    clock.advance(1);
+  }
+
+  unsigned long const start = clock.now();
+
+  group.move(second, 300, Profile::SCURVE);
+
+  while (group.is_moving()) {
+    group.tick();
+    clock.advance(1);
+
+    ASSERT_EQ(b.pos(), 40);
+  }
+
+  ASSERT_EQ(a.pos(), 40);
+  ASSERT_GE(clock.now() - start, 300);
+  ASSERT_LE(clock.now() - start, 302); // Arrival, then the next update.
+}
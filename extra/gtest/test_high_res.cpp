@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+
+TEST(HighRes, should_be_disabled_by_default) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  EXPECT_FALSE(pservo.props().is_high_res);
+  EXPECT_EQ(pservo.props().frac, 0);
+  EXPECT_EQ(pservo.pos_us(), Default::MIN_PULSE);
+
+  pservo.set_high_res(true);
+  EXPECT_TRUE(pservo.props().is_high_res);
+}
+
+TEST(HighRes, should_convert_the_position_to_microseconds) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  for (pservo.begin(1)->move(90, 1); pservo.pos() < 90; ++timer)
+    pservo.begin(1)->move(90, 1);
+
+  EXPECT_NEAR(pservo.pos_us(), 1472, 1);
+
+  for (pservo.begin(1)->move(180, 1); pservo.pos() < 180; ++timer)
+    pservo.begin(1)->move(180, 1);
+
+  EXPECT_NEAR(pservo.pos_us(), Default::MAX_PULSE, 1);
+}
+
+TEST(HighRes, should_move_in_fractions_of_degree) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.set_high_res(true);
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+
+  timer = 50;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.pos(), 0);
+  EXPECT_EQ(pservo.props().frac, 128);
+
+  timer = 150;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.pos(), 1);
+  EXPECT_EQ(pservo.props().frac, 128);
+
+  // Arrives on time, and the next action counts from that instant.
+  timer = 200;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.pos(), 2);
+  EXPECT_EQ(pservo.props().frac, 0);
+  EXPECT_EQ(pservo.props().pc, 200);
+
+  // Going down, the fraction is always counted upwards from `pos()`.
+  timer = 225;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.props().active_action, 1);
+  EXPECT_EQ(pservo.pos(), 1);
+  EXPECT_EQ(pservo.props().frac, 192);
+
+  timer = 400;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.pos(), 0);
+  EXPECT_EQ(pservo.props().frac, 0);
+
+  ++timer;
+  pservo.begin(2)->move(2, 100)->move(0, 100);
+  EXPECT_EQ(pservo.get_state(), State::HALT);
+}
+
+TEST(HighRes, should_sweep_in_fractions_of_degree) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.set_high_res(true);
+  pservo.begin(1)->sweep(10, 1000, Profile::LINEAR);
+
+  timer = 50;
+  pservo.begin(1)->sweep(10, 1000, Profile::LINEAR);
+  EXPECT_EQ(pservo.pos(), 0);
+  EXPECT_GT(pservo.props().frac, 0);
+
+  // Same sweep, but without the fractions.
+  unsigned long other_timer = 0;
+
+  PServo other(&other_timer);
+
+  other.begin(1)->sweep(10, 1000, Profile::LINEAR);
+  other_timer = 50;
+  other.begin(1)->sweep(10, 1000, Profile::LINEAR);
+  EXPECT_EQ(other.pos(), 0);
+  EXPECT_EQ(other.props().frac, 0);
+
+  for (timer = 51; timer <= 1000; ++timer) {
+    unsigned short const before = pservo.pos_us();
+
+    pservo.begin(1)->sweep(10, 1000, Profile::LINEAR);
+    ASSERT_GE(pservo.pos_us(), before) << "at " << timer;
+  }
+
+  EXPECT_EQ(pservo.pos(), 10);
+  EXPECT_EQ(pservo.props().frac, 0);
+}
+
+TEST(HighRes, should_drop_the_fraction_when_disabled) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.set_high_res(true);
+  pservo.begin(1)->move(10, 100);
+
+  timer = 30;
+  pservo.begin(1)->move(10, 100);
+  ASSERT_GT(pservo.props().frac, 0);
+
+  pservo.set_high_res(false);
+  EXPECT_EQ(pservo.props().frac, 0);
+  EXPECT_EQ(pservo.pos(), 0);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+#include "../host/FakeClock.h"
+
+// Only built with `make test/instrument`, the counters don't exist otherwise.
+#if defined(PS_INSTRUMENT)
+TEST(Instrument, should_count_ticks_and_steps) {
+  using namespace ps;
+
+  Action const scene[] = {{10, 10}};
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.load(scene, 1);
+
+  for (clock.set(0); clock.now() < 200; clock.advance(1))
+    pservo.tick();
+
+  Stats const stats = pservo.props().stats;
+
+  ASSERT_EQ(stats.ticks, 200);
+  ASSERT_EQ(stats.steps, 10);
+  ASSERT_EQ(stats.missed, 0);
+  ASSERT_EQ(stats.max_lateness, 0);
+  ASSERT_EQ(stats.last, 199);
+}
+
+TEST(Instrument, should_count_missed_deadlines) {
+  using namespace ps;
+
+  Action const scene[] = {{5, 10}, {0, 100}};
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.load(scene, 2);
+
+  for (clock.set(0); clock.now() < 200; clock.advance(25)) // Too slow.
+    pservo.tick();
+
+  Stats const stats = pservo.props().stats;
+
+  ASSERT_EQ(stats.steps, 5);
+  ASSERT_EQ(stats.missed, 4);
+  ASSERT_EQ(stats.max_lateness, 15);
+}
+
+TEST(Instrument, should_count_the_time_in_each_state) {
+  using namespace ps;
+
+  Action const scene[] = {{20, 5}};
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.load(scene, 1);
+
+  for (clock.set(0); clock.now() <= 300; clock.advance(1))
+    pservo.tick();
+
+  Stats const stats = pservo.props().stats;
+  unsigned long const in_action =
+      stats.in_state[(unsigned char)State::IN_ACTION];
+  unsigned long const halt = stats.in_state[(unsigned char)State::HALT];
+
+  ASSERT_TRUE(pservo.is_state(State::HALT));
+  ASSERT_NEAR(in_action, 100, 2); // 20 degrees, 5 units each.
+  ASSERT_EQ(in_action + halt, 300);
+}
+
+TEST(Instrument, should_count_the_chain_updates) {
+  using namespace ps;
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  for (clock.set(0); clock.now() < 50; clock.advance(1))
+    pservo.begin()->move(10, 2);
+
+  Stats const stats = pservo.props().stats;
+
+  ASSERT_EQ(stats.ticks, 50);
+  ASSERT_EQ(stats.steps, 10);
+  ASSERT_EQ(stats.in_state[(unsigned char)State::INITIALIZED], 1);
+}
+
+TEST(Instrument, should_clear_the_counters) {
+  using namespace ps;
+
+  Action const scene[] = {{10, 1}};
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.load(scene, 1);
+
+  for (clock.set(0); clock.now() < 20; clock.advance(1))
+    pservo.tick();
+
+  pservo.clear_stats();
+
+  Stats const stats = pservo.props().stats;
+
+  ASSERT_EQ(stats.ticks, 0);
+  ASSERT_EQ(stats.steps, 0);
+  ASSERT_EQ(stats.in_state[(unsigned char)State::HALT], 0);
+}
+#endif
@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "../../src/Kernel.h"
+#include "../../src/PServo.h"
+
+namespace {
+typedef struct Arrays {
+  std::vector<unsigned char> pos, target, min, max, go;
+  std::vector<unsigned long> pc;
+  std::vector<unsigned short> delay;
+
+  Arrays(unsigned short const count)
+      : pos(count), target(count), min(count), max(count), go(count),
+        pc(count), delay(count) {}
+
+  ps::kernel::Batch batch(void) {
+    return ps::kernel::Batch{
+        .pos = pos.data(),
+        .target = target.data(),
+        .min = min.data(),
+        .max = max.data(),
+        .pc = pc.data(),
+        .delay = delay.data(),
+        .go = go.data(),
+        .count = (unsigned short)pos.size(),
+    };
+  }
+} Arrays;
+}; // namespace
+
+TEST(Kernel, should_match_the_scalar_version_bit_by_bit) {
+  using namespace ps;
+
+  unsigned short const COUNT = 1000; // Not a multiple of any vector width.
+
+  std::srand(42);
+
+  Arrays vector(COUNT);
+  Arrays scalar(COUNT);
+
+  for (unsigned short i = 0; i < COUNT; ++i) {
+    vector.pos[i] = std::rand() % 256;
+    vector.target[i] = std::rand() % 256;
+    vector.min[i] = std::rand() % 256; // Even min > max should match.
+    vector.max[i] = std::rand() % 256;
+    vector.pc[i] = 0;
+    vector.delay[i] = std::rand() % 4;
+  }
+
+  scalar = vector;
+
+  for (unsigned long now = 0; now < 600; now += std::rand() % 3) {
+    kernel::advance(vector.batch(), now);
+    kernel::advance_scalar(scalar.batch(), now);
+
+    ASSERT_EQ(vector.pos, scalar.pos) << "at " << now;
+    ASSERT_EQ(vector.pc, scalar.pc) << "at " << now;
+    ASSERT_EQ(vector.go, scalar.go) << "at " << now;
+  }
+}
+
+TEST(Kernel, should_match_the_move_path_of_the_state_machine) {
+  using namespace ps;
+
+  unsigned short const COUNT = 67;
+  unsigned long timer = 0;
+
+  std::srand(7);
+
+  Arrays arrays(COUNT);
+  std::vector<PServo> machines;
+
+  for (unsigned short i = 0; i < COUNT; ++i) {
+    arrays.target[i] = std::rand() % 200;
+    arrays.min[i] = std::rand() % 40;
+    arrays.max[i] = 140 + std::rand() % 60;
+    arrays.delay[i] = 1 + std::rand() % 5;
+
+    machines.emplace_back(&timer, arrays.min[i], arrays.max[i], false);
+    machines.back().begin()->move(arrays.target[i], arrays.delay[i]);
+  }
+
+  for (unsigned short loop = 0; loop < 2000; ++loop) {
+    timer += std::rand() % 4;
+
+    kernel::advance(arrays.batch(), timer);
+
+    for (unsigned short i = 0; i < COUNT; ++i) {
+      PServo &m = machines[i];
+
+      m.begin()->move(arrays.target[i], arrays.delay[i]);
+
+      ASSERT_EQ(arrays.pos[i], m.pos()) << "servo " << i;
+
+      if (m.is_state(State::IN_ACTION)) { // Halted ones may have an older pc.
+        ASSERT_EQ(arrays.pc[i], m.props().pc) << "servo " << i;
+      }
+    }
+  }
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "../../src/Queue.h"
+#include "../../src/ScenePlayer.h"
+#include "../host/FakeClock.h"
+#include "../host/SceneFile.h"
+
+namespace {
+// Position of every millisecond, until the machine halts.
+std::vector<unsigned char> run(ps::PServo &pservo, ps::sim::FakeClock &clock) {
+  std::vector<unsigned char> path;
+
+  for (clock.set(0); not pservo.is_state(ps::State::HALT); clock.advance(1)) {
+    pservo.tick();
+    path.push_back(pservo.pos());
+
+    if (path.size() > 100000)
+      break;
+  }
+
+  return path;
+}
+
+// Where the machine was when it left each waypoint behind.
+std::vector<unsigned char> turns(ps::PServo &pservo,
+                                 ps::sim::FakeClock &clock) {
+  std::vector<unsigned char> turns;
+  unsigned char action = 0;
+
+  for (clock.set(0); not pservo.is_state(ps::State::HALT); clock.advance(1)) {
+    pservo.tick();
+
+    if (pservo.props().active_action != action) {
+      action = pservo.props().active_action;
+      turns.push_back(pservo.pos());
+    }
+  }
+
+  return turns;
+}
+}; // namespace
+
+TEST(Lookahead, should_finish_a_path_sooner_within_the_tolerance) {
+  using namespace ps;
+
+  Action const path[] = {
+      {90, 1000, Profile::SCURVE},
+      {30, 1000, Profile::TRAPEZOID},
+      {150, 1000, Profile::SCURVE},
+      {100, 5},
+      {0, 1000, Profile::SCURVE},
+  };
+
+  sim::FakeClock clock;
+
+  PServo hard(clock);
+  PServo blended(clock);
+  PServo again(clock);
+
+  blended.set_lookahead(true, 3);
+  again.set_lookahead(true, 3);
+
+  hard.load(path, 5);
+  blended.load(path, 5);
+  again.load(path, 5);
+
+  unsigned long const hard_time = run(hard, clock).size();
+  unsigned long const blended_time = run(blended, clock).size();
+
+  ASSERT_LT(blended_time, hard_time);
+  ASSERT_EQ(blended.pos(), 0); // The last one is never cut.
+
+  std::vector<unsigned char> const at = turns(again, clock);
+
+  ASSERT_EQ(at.size(), 5);
+
+  for (unsigned char i = 0; i < 5; ++i)
+    ASSERT_LE(abs(at[i] - path[i].pos), 3) << "waypoint " << (int)i;
+}
+
+TEST(Lookahead, should_keep_moving_through_the_same_direction) {
+  using namespace ps;
+
+  Action const path[] = {
+      {60, 900, Profile::SCURVE},
+      {120, 900, Profile::SCURVE},
+      {180, 900, Profile::SCURVE},
+  };
+
+  sim::FakeClock clock;
+
+  PServo hard(clock);
+  PServo blended(clock);
+
+  blended.set_lookahead(true); // No tolerance, the waypoints are exact.
+
+  hard.load(path, 3);
+  blended.load(path, 3);
+
+  std::vector<unsigned char> const hard_path = run(hard, clock);
+  std::vector<unsigned char> const blended_path = run(blended, clock);
+
+  // Same timing, but it doesn't stop to pass through each waypoint.
+  ASSERT_NEAR(blended_path.size(), hard_path.size(), 3);
+  ASSERT_EQ(blended_path[900], 60);
+  ASSERT_EQ(blended_path[1801], 120); // Noticed the first one a bit later.
+
+  unsigned short hard_stops = 0;
+  unsigned short blended_stops = 0;
+
+  for (unsigned char const pos : hard_path)
+    hard_stops += pos == 60 or pos == 120;
+
+  for (unsigned char const pos : blended_path)
+    blended_stops += pos == 60 or pos == 120;
+
+  ASSERT_LT(blended_stops * 3, hard_stops);
+}
+
+TEST(Lookahead, should_not_cut_dwells_nor_short_moves) {
+  using namespace ps;
+
+  Action const path[] = {
+      {90, 500, Profile::SCURVE},
+      {90, 300, Profile::SCURVE}, // Stays there for a while.
+      {88, 200, Profile::SCURVE}, // Shorter than the tolerance.
+      {0, 500, Profile::SCURVE},
+  };
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.set_lookahead(true, 5);
+  pservo.load(path, 4);
+
+  std::vector<unsigned char> const at = turns(pservo, clock);
+
+  ASSERT_EQ(at.size(), 4);
+  ASSERT_LE(abs(at[0] - 90), 5);
+  ASSERT_EQ(at[1], 90);
+  ASSERT_EQ(at[2], 88);
+  ASSERT_EQ(pservo.pos(), 0);
+}
+
+TEST(Lookahead, should_do_nothing_when_disabled) {
+  using namespace ps;
+
+  Action const path[] = {
+      {90, 1000, Profile::SCURVE},
+      {30, 10},
+      {150, 1000, Profile::TRAPEZOID},
+  };
+
+  sim::FakeClock clock;
+
+  PServo plain(clock);
+  PServo disabled(clock);
+
+  disabled.set_lookahead(false, 10);
+
+  plain.load(path, 3);
+  disabled.load(path, 3);
+
+  ASSERT_EQ(run(plain, clock), run(disabled, clock));
+  ASSERT_FALSE(disabled.props().is_looking_ahead);
+  ASSERT_EQ(disabled.props().tolerance, 10);
+
+  disabled.set_lookahead(false, 40);
+  ASSERT_EQ(disabled.props().tolerance, Default::TOLERANCE);
+}
+
+TEST(Lookahead, should_peek_from_the_sources) {
+  using namespace ps;
+
+  Action const path[] = {
+      {60, 700, Profile::SCURVE},
+      {120, 700, Profile::TRAPEZOID},
+      {20, 3},
+      {100, 700, Profile::SCURVE},
+  };
+
+  std::vector<unsigned char> const bytes = binary::encode(path, 4);
+
+  sim::FakeClock clock;
+
+  PServo table(clock);
+  PServo queued(clock);
+  PServo played(clock);
+
+  Queue<4> queue;
+  MemorySource memory(bytes.data(), bytes.size());
+  ScenePlayer player(&memory);
+
+  for (Action const &action : path)
+    queue.push(action);
+
+  table.set_lookahead(true, 4);
+  queued.set_lookahead(true, 4);
+  played.set_lookahead(true, 4);
+
+  table.load(path, 4);
+  queued.play(&queue);
+  played.play(&player);
+
+  std::vector<unsigned char> const expected = run(table, clock);
+
+  ASSERT_EQ(run(queued, clock), expected);
+  ASSERT_EQ(run(played, clock), expected);
+}
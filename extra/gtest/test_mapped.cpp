@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../host/MappedScene.h"
+#include "../host/SceneFile.h"
+#include "../host/Sim.h"
+
+TEST(Mapped, should_play_a_long_scene_straight_from_the_file) {
+  using namespace ps;
+
+  std::string const path = testing::TempDir() + "pservo_mapped.bin";
+  std::vector<Action> choreography;
+
+  for (unsigned short i = 0; i < 1000; ++i)
+    choreography.push_back({(unsigned char)(i % 2 ? 10 : 20), 3});
+
+  ASSERT_TRUE(
+      binary::save(path.c_str(), choreography.data(), choreography.size()));
+
+  binary::MappedScene scene(path.c_str());
+
+  ASSERT_TRUE(scene.is_open());
+  ASSERT_EQ(scene.count(), 1000);
+  ASSERT_EQ(scene.size(), format::HEADER_SIZE + 1000 * format::RECORD_SIZE);
+
+  MemorySource bytes = scene.bytes();
+  ScenePlayer player(&bytes);
+  sim::Engine engine;
+  PServo machine(engine.timer());
+
+  machine.play(&player);
+  engine.set_tracing(false);
+  engine.add(&machine);
+  engine.run();
+
+  // 20 deg to get there, then 999 moves of 10 deg, 3 ms each, and it notices
+  // that the last one is done on the next update.
+  ASSERT_TRUE(machine.is_state(State::HALT));
+  ASSERT_EQ(machine.pos(), 10);
+  ASSERT_EQ(engine.now(), (20 + 999 * 10) * 3 + 1);
+
+  std::remove(path.c_str());
+}
+
+TEST(Mapped, should_share_the_same_mapping_between_machines) {
+  using namespace ps;
+
+  std::string const path = testing::TempDir() + "pservo_shared.bin";
+  Action const wave[] = {{4, 2}, {0, 2}};
+
+  ASSERT_TRUE(binary::save(path.c_str(), wave, 2));
+
+  binary::MappedScene scene(path.c_str());
+  MemorySource first_bytes = scene.bytes();
+  MemorySource second_bytes = scene.bytes();
+  ScenePlayer first_player(&first_bytes);
+  ScenePlayer second_player(&second_bytes);
+
+  unsigned long timer = 0;
+
+  PServo first(&timer);
+  PServo second(&timer);
+
+  first.play(&first_player);
+
+  for (timer = 0; timer < 5; ++timer)
+    first.tick();
+
+  second.play(&second_player); // Starts later, from its own first action.
+
+  for (; first.is_state(State::IN_ACTION); ++timer) {
+    first.tick();
+    second.tick();
+  }
+
+  ASSERT_EQ(first.pos(), 0);
+  ASSERT_TRUE(second.is_state(State::IN_ACTION));
+  ASSERT_EQ(second.props().active_action, 1);
+
+  std::remove(path.c_str());
+}
+
+TEST(Mapped, should_not_open_a_missing_file) {
+  using namespace ps;
+
+  binary::MappedScene scene("/nonexistent/pservo_scene.bin");
+
+  unsigned long timer = 0;
+  MemorySource bytes = scene.bytes();
+  ScenePlayer player(&bytes);
+  PServo machine(&timer);
+
+  ASSERT_FALSE(scene.is_open());
+  ASSERT_EQ(scene.count(), 0);
+
+  machine.play(&player);
+  ASSERT_TRUE(machine.is_state(State::ERROR_NOACTION));
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../host/SceneFile.h"
+
+namespace {
+ps::Action const SCENE[] = {{90, 10},
+                            {90, 300},
+                            {180, 1500, ps::Profile::SCURVE},
+                            {20, 2, ps::Profile::STEP},
+                            {60, 65535, ps::Profile::TRAPEZOID},
+                            {0, 3, ps::Profile::LINEAR}};
+unsigned char const SCENE_COUNT = sizeof(SCENE) / sizeof(SCENE[0]);
+
+// Gives only the bytes that already "arrived", like a serial port.
+class Trickle : public ps::ByteSource {
+public:
+  std::vector<unsigned char> bytes;
+  unsigned long arrived = 0;
+  unsigned long at = 0;
+
+  int read(void) override { return at < arrived ? bytes[at++] : -1; }
+};
+}; // namespace
+
+TEST(Player, should_encode_and_decode_the_same_scene) {
+  using namespace ps;
+
+  std::vector<unsigned char> const bytes = binary::encode(SCENE, SCENE_COUNT);
+
+  ASSERT_EQ(bytes.size(),
+            format::HEADER_SIZE + SCENE_COUNT * format::RECORD_SIZE);
+  ASSERT_EQ(bytes[0], 'P');
+  ASSERT_EQ(bytes[1], 'S');
+  ASSERT_EQ(bytes[2], format::VERSION);
+
+  std::vector<Action> const actions = binary::decode(bytes);
+
+  ASSERT_EQ(actions.size(), SCENE_COUNT);
+
+  for (unsigned char i = 0; i < SCENE_COUNT; ++i) {
+    ASSERT_EQ(actions[i].pos, SCENE[i].pos);
+    ASSERT_EQ(actions[i].delay, SCENE[i].delay);
+    ASSERT_EQ(actions[i].profile, SCENE[i].profile);
+  }
+}
+
+TEST(Player, should_move_just_like_the_loaded_table) {
+  using namespace ps;
+
+  std::vector<unsigned char> const bytes = binary::encode(SCENE, 4);
+  MemorySource source(bytes.data(), bytes.size());
+  ScenePlayer player(&source);
+
+  unsigned long timer = 0;
+
+  PServo loaded(&timer);
+  PServo streamed(&timer);
+
+  loaded.load(SCENE, 4);
+  streamed.play(&player);
+
+  ASSERT_EQ(streamed.props().source, &player);
+  ASSERT_EQ(streamed.props().actions, nullptr);
+
+  for (; loaded.is_state(State::IN_ACTION); ++timer) {
+    loaded.tick();
+    streamed.tick();
+
+    ASSERT_EQ(streamed.pos(), loaded.pos()) << "at " << timer;
+    ASSERT_EQ(streamed.get_state(), loaded.get_state()) << "at " << timer;
+    ASSERT_EQ(streamed.due(), loaded.due()) << "at " << timer;
+  }
+
+  ASSERT_TRUE(streamed.is_state(State::HALT));
+}
+
+TEST(Player, should_rewind_when_the_machine_is_resetable) {
+  using namespace ps;
+
+  Action const wave[] = {{3, 1}, {0, 1}};
+  std::vector<unsigned char> const bytes = binary::encode(wave, 2);
+  MemorySource source(bytes.data(), bytes.size());
+  ScenePlayer player(&source);
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, true);
+
+  pservo.play(&player);
+
+  for (timer = 1; timer < 100; ++timer) {
+    pservo.tick();
+    ASSERT_TRUE(pservo.is_state(State::IN_ACTION));
+  }
+
+  ASSERT_LE(pservo.pos(), 3);
+}
+
+TEST(Player, should_wait_for_a_record_that_arrives_in_parts) {
+  using namespace ps;
+
+  Trickle trickle;
+  ScenePlayer player(&trickle);
+  Action action;
+
+  trickle.bytes = binary::encode(SCENE, 2);
+
+  for (trickle.arrived = 0; trickle.arrived < 8; ++trickle.arrived)
+    ASSERT_FALSE(player.next(&action));
+
+  ASSERT_TRUE(player.next(&action)); // First record is complete.
+  ASSERT_EQ(action.pos, SCENE[0].pos);
+  ASSERT_FALSE(player.next(&action));
+
+  trickle.arrived = 10;
+  ASSERT_FALSE(player.next(&action));
+
+  trickle.arrived = 12;
+  ASSERT_TRUE(player.next(&action));
+  ASSERT_EQ(action.pos, SCENE[1].pos);
+  ASSERT_EQ(action.delay, SCENE[1].delay);
+  ASSERT_TRUE(player.is_valid());
+}
+
+TEST(Player, should_refuse_a_broken_scene) {
+  using namespace ps;
+
+  unsigned char const no_header[] = {90, 10, 0, 0};
+  unsigned char const bad_profile[] = {'P', 'S', 1, 0, 90, 10, 0, 0xFF};
+  unsigned long timer = 0;
+  Action action;
+
+  MemorySource first(no_header, sizeof(no_header));
+  ScenePlayer no_header_player(&first);
+  PServo pservo(&timer);
+
+  pservo.play(&no_header_player);
+  ASSERT_FALSE(no_header_player.is_valid());
+  ASSERT_TRUE(pservo.is_state(State::ERROR_NOACTION));
+
+  MemorySource second(bad_profile, sizeof(bad_profile));
+  ScenePlayer bad_profile_player(&second);
+
+  ASSERT_FALSE(bad_profile_player.next(&action));
+  ASSERT_FALSE(bad_profile_player.is_valid());
+}
+
+TEST(Player, should_stream_from_a_file) {
+  using namespace ps;
+
+  std::string const path = testing::TempDir() + "pservo_scene.bin";
+
+  ASSERT_TRUE(binary::save(path.c_str(), SCENE, SCENE_COUNT));
+
+  binary::FileSource file(path.c_str());
+  ScenePlayer player(&file);
+  Action action;
+
+  ASSERT_TRUE(file.is_open());
+
+  for (unsigned char i = 0; i < SCENE_COUNT; ++i) {
+    ASSERT_TRUE(player.next(&action));
+    ASSERT_EQ(action.delay, SCENE[i].delay);
+  }
+
+  ASSERT_FALSE(player.next(&action));
+  ASSERT_TRUE(player.rewind());
+  ASSERT_TRUE(player.next(&action));
+  ASSERT_EQ(action.pos, SCENE[0].pos);
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+#include "../host/FakeClock.h"
+
+TEST(Poll, should_tell_only_the_position_changes) {
+  using namespace ps;
+
+  Action const scene[] = {{30, 10}, {10, 5}};
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.load(scene, 2);
+
+  ASSERT_TRUE(pservo.poll()); // Nothing was written yet.
+  ASSERT_FALSE(pservo.poll());
+
+  unsigned short writes = 0;
+
+  for (clock.set(0); clock.now() < 1000; clock.advance(1)) {
+    unsigned char const before = pservo.pos();
+
+    pservo.tick();
+
+    bool const is_changed = pservo.poll();
+
+    ASSERT_EQ(is_changed, pservo.pos() != before) << "at " << clock.now();
+    writes += is_changed;
+  }
+
+  ASSERT_EQ(writes, 30 + 20);
+}
+
+TEST(Poll, should_count_the_fraction_of_degree) {
+  using namespace ps;
+
+  sim::FakeClock clock;
+  PServo pservo(clock);
+
+  pservo.set_high_res(true);
+
+  ASSERT_TRUE(pservo.poll());
+
+  unsigned short writes = 0;
+
+  for (clock.set(0); clock.now() < 100; clock.advance(1)) {
+    pservo.begin(1)->move(1, 100);
+    writes += pservo.poll();
+  }
+
+  ASSERT_EQ(pservo.pos(), 0);
+  ASSERT_GT(writes, 50); // Many, but less than a degree.
+
+  pservo.poll();
+  pservo.set_high_res(false); // Drops the fraction, so it moves back.
+  ASSERT_TRUE(pservo.poll());
+}
+
+TEST(Poll, should_give_only_the_changed_machines) {
+  using namespace ps;
+
+  Action const fast[] = {{180, 1}};
+  Action const slow[] = {{180, 4}};
+
+  sim::FakeClock clock;
+
+  PServo a(clock);
+  PServo b(clock);
+  PServo c(clock);
+
+  a.load(fast, 1);
+  b.load(slow, 1);
+
+  PServo *const machines[] = {&a, &b, &c};
+  unsigned short changed[3];
+
+  ASSERT_EQ(poll(machines, 3, changed), 3);
+
+  for (clock.set(1); clock.now() <= 16; clock.advance(1)) {
+    for (PServo *const machine : machines)
+      machine->tick();
+
+    unsigned short const count = poll(machines, 3, changed);
+
+    if (clock.now() % 4 == 0) {
+      ASSERT_EQ(count, 2) << "at " << clock.now();
+      ASSERT_EQ(changed[0], 0);
+      ASSERT_EQ(changed[1], 1);
+    } else {
+      ASSERT_EQ(count, 1) << "at " << clock.now();
+      ASSERT_EQ(changed[0], 0);
+    }
+  }
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+#include "../host/FakeClock.h"
+
+TEST(Profile, should_share_the_limits) {
+  using namespace ps;
+
+  ServoProfile model = {20, 160, 1, 544, 2400};
+  sim::FakeClock clock;
+
+  PServo a(clock, model);
+  PServo b(clock, model, true);
+
+  ASSERT_EQ(a.props().min, 20);
+  ASSERT_EQ(a.props().max, 160);
+  ASSERT_EQ(a.props().profile, &model);
+  ASSERT_TRUE(b.props().is_resetable);
+
+  for (clock.set(0); clock.now() < 400; clock.advance(1)) {
+    a.begin(1)->move(180);
+    b.begin(1)->move(180);
+  }
+
+  ASSERT_EQ(a.pos(), 160);
+  ASSERT_EQ(b.pos(), 160);
+
+  model.max = 100; // Both machines follow the change.
+
+  for (; clock.now() < 800; clock.advance(1)) {
+    a.begin(1)->move(180);
+    b.begin(1)->move(180);
+  }
+
+  ASSERT_EQ(a.pos(), 100);
+  ASSERT_EQ(b.pos(), 100);
+  ASSERT_EQ(b.props().max, 100);
+}
+
+TEST(Profile, should_use_the_default_delay) {
+  using namespace ps;
+
+  ServoProfile const model = {0, 180, 10, 544, 2400};
+  sim::FakeClock clock(1000);
+
+  PServo pservo(clock, model);
+
+  for (; clock.now() < 1000 + 100; clock.advance(1))
+    pservo.begin(1)->move(180);
+
+  ASSERT_EQ(pservo.pos(), 10);
+  ASSERT_EQ(pservo.props().delay, 10);
+}
+
+TEST(Profile, should_use_the_calibration) {
+  using namespace ps;
+
+  ServoProfile model = {0, 180, 1, 1000, 2000};
+  ServoProfile const standard = {0, 180, 1, Default::MIN_PULSE,
+                                 Default::MAX_PULSE};
+  sim::FakeClock clock;
+
+  PServo pservo(clock, model);
+  PServo plain(clock);
+  PServo calibrated(clock, standard);
+
+  ASSERT_EQ(pservo.pos_us(), 1000);
+
+  for (clock.set(0); clock.now() <= 90; clock.advance(1)) {
+    pservo.begin(1)->move(90);
+    plain.begin(1)->move(90);
+    calibrated.begin(1)->move(90);
+
+    ASSERT_NEAR(calibrated.pos_us(), plain.pos_us(), 1);
+  }
+
+  ASSERT_EQ(pservo.pos_us(), 1500);
+
+  model.max_pulse = 2200; // Recalibrated at runtime.
+
+  ASSERT_EQ(pservo.pos_us(), 1600);
+}
+
+TEST(Profile, should_work_with_a_timer) {
+  using namespace ps;
+
+  ServoProfile const model = {0, 180, 1, 544, 2400};
+  unsigned long timer = 0;
+
+  PServo plain(&timer, 0, 180, false);
+  PServo shared(&timer, model);
+
+  ASSERT_EQ(plain.props().profile, nullptr);
+  ASSERT_EQ(shared.props().min, plain.props().min);
+  ASSERT_EQ(shared.props().max, plain.props().max);
+}
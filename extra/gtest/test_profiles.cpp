@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include "../../src/Scene.h"
+
+namespace {
+ps::Profile const SWEEPS[] = {ps::Profile::LINEAR, ps::Profile::TRAPEZOID,
+                              ps::Profile::SCURVE};
+}; // namespace
+
+TEST(Profiles, should_ease_from_the_start_to_the_end) {
+  using namespace ps;
+
+  for (Profile const p : SWEEPS) {
+    EXPECT_EQ(ease(p, 0), 0);
+    EXPECT_GE(ease(p, 255), 254);
+    EXPECT_NEAR(ease(p, 128), 128, 1); // All of them are symmetric.
+
+    for (unsigned short phase = 1; phase < 256; ++phase)
+      ASSERT_GE(ease(p, phase), ease(p, phase - 1)) << "never goes back";
+  }
+
+  // Smooth profiles start slower and end slower than the linear one.
+  EXPECT_LT(ease(Profile::TRAPEZOID, 32), ease(Profile::LINEAR, 32));
+  EXPECT_LT(ease(Profile::SCURVE, 32), ease(Profile::TRAPEZOID, 32));
+  EXPECT_GT(ease(Profile::SCURVE, 224), ease(Profile::LINEAR, 224));
+}
+
+TEST(Profiles, should_complete_the_sweep_on_the_given_duration) {
+  using namespace ps;
+
+  for (Profile const p : SWEEPS) {
+    unsigned long timer = 100;
+
+    PServo pservo(&timer);
+
+    pservo.begin(1)->sweep(180, 1000, p);
+
+    for (timer = 101; timer < 1100; ++timer) {
+      pservo.begin(1)->sweep(180, 1000, p);
+      ASSERT_LT(pservo.pos(), 180) << "at " << timer;
+    }
+
+    pservo.begin(1)->sweep(180, 1000, p);
+    ASSERT_EQ(pservo.pos(), 180);
+
+    ++timer;
+    pservo.begin(1)->sweep(180, 1000, p);
+    ASSERT_EQ(pservo.get_state(), State::HALT);
+  }
+}
+
+TEST(Profiles, should_follow_the_curve_when_updated_at_any_pace) {
+  using namespace ps;
+
+  unsigned short const DURATIONS[] = {7, 300, 1000, 65535};
+  unsigned long const PACES[] = {1, 13, 97, 1024};
+
+  for (Profile const p : SWEEPS) {
+    for (unsigned short const duration : DURATIONS) {
+      for (unsigned long const pace : PACES) {
+        unsigned long timer = 0;
+
+        PServo pservo(&timer);
+
+        pservo.begin(1)->sweep(180, duration, p);
+
+        for (timer = pace; timer < duration; timer += pace) {
+          unsigned char const phase = (timer << 8) / duration;
+          unsigned char const pos = p == Profile::LINEAR // To the degree.
+                                        ? 180 * timer / duration
+                                        : 180 * ease(p, phase) >> 8;
+
+          pservo.begin(1)->sweep(180, duration, p);
+          ASSERT_EQ(pservo.pos(), pos) << "at " << timer << " of " << duration;
+        }
+      }
+    }
+  }
+}
+
+TEST(Profiles, should_hold_the_position_when_sweeping_to_itself) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.begin(2)->sweep(0, 50, Profile::LINEAR)->move(10, 1);
+
+  for (timer = 1; timer < 50; ++timer) {
+    pservo.begin(2)->sweep(0, 50, Profile::LINEAR)->move(10, 1);
+    ASSERT_EQ(pservo.props().active_action, 0);
+  }
+
+  pservo.begin(2)->sweep(0, 50, Profile::LINEAR)->move(10, 1);
+  ASSERT_EQ(pservo.props().active_action, 1);
+  ASSERT_EQ(pservo.props().pc, 50); // The next action counts from here.
+
+  ++timer;
+  pservo.begin(2)->sweep(0, 50, Profile::LINEAR)->move(10, 1);
+  ASSERT_EQ(pservo.pos(), 1);
+}
+
+TEST(Profiles, should_clamp_the_target_to_the_limits) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, 20, 160, false);
+
+  pservo.begin(1)->sweep(200, 10, Profile::SCURVE);
+
+  for (timer = 1; timer < 20; ++timer) {
+    pservo.begin(1)->sweep(200, 10, Profile::SCURVE);
+    ASSERT_GE(pservo.pos(), 20);
+    ASSERT_LE(pservo.pos(), 160);
+  }
+
+  ASSERT_EQ(pservo.get_state(), State::HALT);
+  ASSERT_EQ(pservo.pos(), 160);
+}
+
+TEST(Profiles, should_mirror_the_chained_api_on_compiled_scenes) {
+  using namespace ps;
+
+  typedef Scene<Move<90, 300, Profile::TRAPEZOID>, Move<45, 2>,
+                Move<180, 700, Profile::SCURVE>>
+      Mixed;
+
+  static_assert(Mixed::duration == 300 + 45 * 2 + 700, "Should sum all.");
+
+  unsigned long timer = 0;
+
+  PServo chained(&timer);
+  PServo compiled(&timer);
+
+  Mixed::load(compiled);
+
+  while (not compiled.is_state(State::HALT)) {
+    chained.begin(3)
+        ->sweep(90, 300, Profile::TRAPEZOID)
+        ->move(45, 2)
+        ->sweep(180, 700, Profile::SCURVE);
+    compiled.tick();
+
+    ASSERT_EQ(compiled.pos(), chained.pos()) << "at " << timer;
+    ASSERT_EQ(compiled.props().active_action, chained.props().active_action);
+
+    ++timer;
+  }
+}
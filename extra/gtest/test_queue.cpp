@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "../../src/Queue.h"
+
+TEST(Queue, should_give_the_actions_in_order_until_it_is_empty) {
+  using namespace ps;
+
+  Queue<4> queue;
+  Action action;
+
+  ASSERT_EQ(queue.capacity(), 4);
+  ASSERT_FALSE(queue.next(&action));
+
+  for (unsigned char i = 0; i < 4; ++i)
+    ASSERT_TRUE(queue.push({i, 10}));
+
+  ASSERT_FALSE(queue.push({4, 10})); // Full, never blocks.
+  ASSERT_EQ(queue.size(), 4);
+
+  for (unsigned char i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.next(&action));
+    ASSERT_EQ(action.pos, i);
+  }
+
+  ASSERT_FALSE(queue.next(&action));
+  ASSERT_EQ(queue.size(), 0);
+  ASSERT_FALSE(queue.rewind());
+}
+
+TEST(Queue, should_move_again_when_new_actions_arrive) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  Queue<8> queue;
+  PServo pservo(&timer);
+
+  pservo.play(&queue);
+  ASSERT_TRUE(pservo.is_state(State::ERROR_NOACTION));
+
+  queue.push({2, 5});
+
+  for (timer = 0; timer <= 11; ++timer)
+    pservo.tick();
+
+  ASSERT_EQ(pservo.pos(), 2);
+  ASSERT_TRUE(pservo.is_state(State::HALT)); // Waiting for more.
+
+  for (; timer <= 20; ++timer)
+    pservo.tick();
+
+  queue.push({0, 1});
+  queue.push({1, 1});
+  pservo.tick();
+
+  ASSERT_TRUE(pservo.is_state(State::IN_ACTION));
+  ASSERT_EQ(pservo.props().delay, 1);
+
+  for (++timer; timer <= 30; ++timer)
+    pservo.tick();
+
+  ASSERT_EQ(pservo.pos(), 1);
+  ASSERT_TRUE(pservo.is_state(State::HALT));
+}
+
+TEST(Queue, should_not_lose_or_reorder_actions_between_threads) {
+  using namespace ps;
+
+  unsigned long const COUNT = 200000;
+
+  Queue<16> queue;
+
+  std::thread producer([&queue] {
+    for (unsigned long i = 0; i < COUNT; ++i) {
+      Action const action = {(unsigned char)(i % 181),
+                             (unsigned short)(i & 0xFFFF),
+                             (Profile)(i % 4)};
+
+      while (not queue.push(action))
+        std::this_thread::yield();
+    }
+  });
+
+  Action action;
+  unsigned long received = 0;
+
+  while (received < COUNT) {
+    if (not queue.next(&action)) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    ASSERT_EQ(action.pos, received % 181);
+    ASSERT_EQ(action.delay, received & 0xFFFF);
+    ASSERT_EQ(action.profile, (Profile)(received % 4));
+    ++received;
+  }
+
+  producer.join();
+
+  ASSERT_FALSE(queue.next(&action));
+}
+
+TEST(Queue, should_feed_a_machine_from_another_thread) {
+  using namespace ps;
+
+  unsigned long const COUNT = 5000;
+
+  Queue<32> queue;
+  std::atomic<bool> is_done(false);
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  pservo.play(&queue);
+
+  std::thread producer([&] {
+    for (unsigned long i = 0; i < COUNT; ++i) {
+      while (not queue.push({(unsigned char)(i % 2 ? 0 : 3), 1}))
+        std::this_thread::yield(); // The control loop is never waited for.
+    }
+
+    is_done = true;
+  });
+
+  while (not is_done or queue.size() > 0 or pservo.is_state(State::IN_ACTION)) {
+    pservo.tick();
+    ++timer;
+  }
+
+  producer.join();
+
+  ASSERT_EQ(pservo.pos(), 0); // The last one goes back to 0.
+  ASSERT_TRUE(pservo.is_state(State::HALT));
+  ASSERT_GT(timer, COUNT); // At least one update for each action.
+}
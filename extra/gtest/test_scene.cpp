@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include "../../src/Scene.h"
+
+namespace {
+using namespace ps;
+
+typedef Scene<Move<90, 5>, Move<180, 20>, Move<0, 5>> Wave;
+typedef LimitedScene<10, 100, Move<120, 2>, Move<0>, Move<50, 3>> Clamped;
+
+static_assert(Wave::count == 3, "Should count the moves.");
+static_assert(Wave::duration == 90 * 5 + 90 * 20 + 180 * 5,
+              "Should sum the time of each degree.");
+static_assert(Wave::actions[1].pos == 180 and Wave::actions[1].delay == 20,
+              "Should keep the moves in order.");
+
+static_assert(Clamped::actions[0].pos == 100, "Should clamp to the max.");
+static_assert(Clamped::actions[1].pos == 10, "Should clamp to the min.");
+static_assert(Clamped::actions[1].delay == Default::DELAY,
+              "Should use the default delay.");
+static_assert(Clamped::duration == 90 * 2 + 90 * 1 + 40 * 3,
+              "Should start from the min and only count the clamped path.");
+}; // namespace
+
+TEST(Scene, should_start_the_first_action_without_counting) {
+  unsigned long timer = 0;
+
+  PServo pservo(&timer);
+
+  Wave::load(pservo);
+  ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
+  ASSERT_EQ(pservo.props().actions_count, 3);
+  ASSERT_EQ(pservo.props().actions, Wave::actions);
+}
+
+TEST(Scene, should_link_the_values_taken_by_reference) {
+  unsigned char const &count = Wave::count; // Not inline before C++17.
+  unsigned long const &duration = Wave::duration;
+  unsigned char const &pos = Move<90, 5>::pos;
+
+  ASSERT_EQ(count, 3);
+  ASSERT_EQ(duration, Wave::duration);
+  ASSERT_EQ(pos, 90);
+}
+
+TEST(Scene, should_mirror_the_chained_api) {
+  unsigned long timer = 0;
+
+  PServo chained(&timer);
+  PServo compiled(&timer);
+
+  Wave::load(compiled);
+  chained.begin()->move(90, 5)->move(180, 20)->move(0, 5);
+
+  while (not compiled.is_state(State::HALT)) {
+    ++timer;
+
+    chained.begin()->move(90, 5)->move(180, 20)->move(0, 5);
+    compiled.tick();
+
+    ASSERT_EQ(compiled.pos(), chained.pos());
+  }
+
+  // The duration doesn't count the loops that notices each completed move.
+  EXPECT_GE(timer, Wave::duration);
+  EXPECT_LE(timer, Wave::duration + Wave::count);
+}
+
+TEST(Scene, should_complete_even_with_targets_out_of_the_limits) {
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, 10, 100, false);
+
+  Clamped::load(pservo);
+
+  for (unsigned long i = 0; i < Clamped::duration * 2; ++i) {
+    ++timer;
+    pservo.tick();
+  }
+
+  ASSERT_EQ(pservo.get_state(), State::HALT);
+  ASSERT_EQ(pservo.pos(), 50);
+}
+
+TEST(Scene, should_play_a_flash_table_just_like_a_ram_one) {
+  Action const scene[] = {{40, 3}, {10, 200, Profile::SCURVE}, {25, 2}};
+  unsigned long timer = 0;
+
+  PServo ram(&timer, true);
+  PServo flash(&timer, true);
+
+  ram.set_lookahead(true, 2); // Peeks at the next action too.
+  flash.set_lookahead(true, 2);
+
+  ram.load(scene, 3);
+  flash.load_progmem(scene, 3);
+
+  for (timer = 0; timer < 2000; ++timer) {
+    ram.tick();
+    flash.tick();
+
+    ASSERT_EQ(flash.pos(), ram.pos()) << "at " << timer;
+    ASSERT_EQ(flash.due(), ram.due()) << "at " << timer;
+  }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include "../../src/Scheduler.h"
+
+TEST(Scheduler, should_have_nothing_to_do_when_empty) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo chained(&timer);
+  Scheduler<2> scheduler(&timer);
+
+  ASSERT_EQ(scheduler.until_next(), Scheduler<2>::NEVER);
+  ASSERT_FALSE(chained.has_scene());
+  ASSERT_FALSE(scheduler.add(&chained)); // Nothing loaded, nothing to do.
+  ASSERT_EQ(scheduler.size(), 0);
+  ASSERT_EQ(scheduler.run(), 0);
+}
+
+TEST(Scheduler, should_tell_the_time_until_the_next_deadline) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const slow[] = {{10, 30}};
+  Action const fast[] = {{10, 12}};
+
+  PServo a(&timer);
+  PServo b(&timer);
+  Scheduler<2> scheduler(&timer);
+
+  a.load(slow, 1);
+  b.load(fast, 1);
+
+  ASSERT_TRUE(a.has_scene());
+  ASSERT_TRUE(scheduler.add(&a));
+  ASSERT_TRUE(scheduler.add(&b));
+  ASSERT_EQ(scheduler.until_next(), 12);
+
+  timer = 5;
+  ASSERT_EQ(scheduler.until_next(), 7);
+  ASSERT_EQ(scheduler.run(), 0);
+
+  timer = 12;
+  ASSERT_EQ(scheduler.until_next(), 0);
+  ASSERT_EQ(scheduler.run(), 1);
+  ASSERT_EQ(b.pos(), 1);
+  ASSERT_EQ(scheduler.until_next(), 12);
+}
+
+TEST(Scheduler, should_start_a_scene_loaded_after_half_the_timer_range) {
+  using namespace ps;
+
+  unsigned long timer = 0x80000010; // About 25 days of `millis()`.
+  Action const scene[] = {{10, 5}};
+
+  PServo pservo(&timer);
+  Scheduler<1> scheduler(&timer);
+
+  pservo.load(scene, 1); // The `_pc` is still zero, way behind the timer.
+
+  ASSERT_TRUE(scheduler.add(&pservo));
+  ASSERT_EQ(scheduler.until_next(), 0);
+  ASSERT_EQ(scheduler.run(), 1);
+  ASSERT_EQ(pservo.pos(), 1); // Same as a plain `tick()`.
+  ASSERT_EQ(scheduler.until_next(), 5);
+}
+
+TEST(Scheduler, should_drop_the_halted_machines) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{3, 1}};
+
+  PServo pservo(&timer, false);
+  Scheduler<1> scheduler(&timer);
+
+  pservo.load(scene, 1);
+  scheduler.add(&pservo);
+
+  while (scheduler.size() > 0) {
+    ++timer;
+    scheduler.run();
+  }
+
+  ASSERT_EQ(pservo.get_state(), State::HALT);
+  ASSERT_EQ(pservo.pos(), 3);
+  ASSERT_EQ(scheduler.until_next(), Scheduler<1>::NEVER);
+}
+
+TEST(Scheduler, should_mirror_polling_every_machine_on_every_loop) {
+  using namespace ps;
+
+  unsigned short const COUNT = 16;
+  unsigned long timer = 0;
+  Action const scenes[][3] = {
+      {{90, 5}, {10, 3}, {10, 7}},
+      {{45, 1}, {0, 9}, {180, 2}},
+      {{0, 4}, {30, 0}, {12, 11}},
+  };
+
+  PServo *polled[COUNT];
+  PServo *scheduled[COUNT];
+  Scheduler<COUNT> scheduler(&timer);
+
+  for (unsigned short i = 0; i < COUNT; ++i) {
+    polled[i] = new PServo(&timer, i % 2 == 0);
+    scheduled[i] = new PServo(&timer, i % 2 == 0);
+
+    polled[i]->set_lookahead(i % 4 == 1, 2); // Cuts the corners of a few.
+    scheduled[i]->set_lookahead(i % 4 == 1, 2);
+    polled[i]->load(scenes[i % 3], 3);
+    scheduled[i]->load(scenes[i % 3], 3);
+
+    ASSERT_TRUE(scheduler.add(scheduled[i]));
+  }
+
+  unsigned long polls = 0;
+  unsigned long runs = 0;
+
+  for (timer = 1; timer < 3000; ++timer) {
+    runs += scheduler.run();
+
+    for (unsigned short i = 0; i < COUNT; ++i) {
+      polled[i]->tick();
+      ++polls;
+
+      ASSERT_EQ(scheduled[i]->pos(), polled[i]->pos()) << "servo " << i;
+      ASSERT_EQ(scheduled[i]->get_state(), polled[i]->get_state())
+          << "servo " << i;
+    }
+  }
+
+  EXPECT_LT(runs, polls / 2); // Most of the loops have nothing to do.
+
+  for (unsigned short i = 0; i < COUNT; ++i) {
+    delete polled[i];
+    delete scheduled[i];
+  }
+}
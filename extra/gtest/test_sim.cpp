@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+
+#include "../host/Sim.h"
+
+namespace {
+ps::Action const SCENE[] = {{30, 10},
+                            {30, 25},
+                            {90, 400, ps::Profile::TRAPEZOID},
+                            {60, 7},
+                            {120, 300, ps::Profile::SCURVE},
+                            {0, 3}};
+unsigned char const SCENE_COUNT = sizeof(SCENE) / sizeof(SCENE[0]);
+}; // namespace
+
+TEST(Sim, should_give_the_same_trace_as_ticking_every_millisecond) {
+  using namespace ps;
+
+  Action const corners[] = {{20, 10}, {0, 10}, {30, 7}};
+
+  struct {
+    Action const *actions;
+    unsigned char count;
+    bool is_looking_ahead;
+    unsigned char tolerance;
+  } const cases[] = {
+      {SCENE, SCENE_COUNT, false, 0},
+      {SCENE, SCENE_COUNT, true, 3},
+      {corners, 3, true, 3}, // Cuts the corners of the steps too.
+  };
+
+  for (auto const &c : cases) {
+    sim::Engine engine;
+    unsigned long timer = 0;
+
+    PServo simulated(engine.timer());
+    PServo replayed(&timer);
+
+    simulated.set_lookahead(c.is_looking_ahead, c.tolerance);
+    replayed.set_lookahead(c.is_looking_ahead, c.tolerance);
+    simulated.load(c.actions, c.count);
+    replayed.load(c.actions, c.count);
+
+    engine.add(&simulated);
+    unsigned long const end = engine.run();
+
+    std::vector<sim::Sample> expected = {{0, 0, replayed.pos(), 0}};
+
+    for (timer = 0; replayed.is_state(State::IN_ACTION) or timer == 0;
+         ++timer) {
+      unsigned char const pos = replayed.pos();
+
+      replayed.tick();
+
+      if (replayed.pos() != pos)
+        expected.push_back({timer, 0, replayed.pos(), 0});
+    }
+
+    ASSERT_TRUE(simulated.is_state(State::HALT));
+    ASSERT_EQ(end, timer - 1); // Halted on the same update.
+    ASSERT_EQ(engine.trace().size(), expected.size());
+
+    for (unsigned short i = 0; i < expected.size(); ++i) {
+      ASSERT_EQ(engine.trace()[i].time, expected[i].time) << "sample " << i;
+      ASSERT_EQ(engine.trace()[i].pos, expected[i].pos) << "sample " << i;
+    }
+
+    ASSERT_LT(engine.ticks(), timer);
+  }
+}
+
+TEST(Sim, should_run_across_the_wrap_point) {
+  using namespace ps;
+
+  unsigned long const START = 0xFFFFFF00; // 256 units before the wrap.
+
+  sim::Engine engine(START);
+  unsigned long timer = START;
+
+  PServo simulated(engine.timer());
+  PServo replayed(&timer);
+
+  simulated.load(SCENE, SCENE_COUNT);
+  replayed.load(SCENE, SCENE_COUNT);
+
+  // Started on the first update, otherwise its deadline would be from the time
+  // 0 -- and that's too far away to tell if it's in the past or the future.
+  simulated.tick();
+  replayed.tick();
+
+  engine.add(&simulated);
+  engine.run();
+
+  std::vector<sim::Sample> expected = {{START, 0, replayed.pos(), 0}};
+
+  for (unsigned long linear = START + 1; not replayed.is_state(State::HALT);
+       ++linear) {
+    unsigned char const pos = replayed.pos();
+
+    timer = linear & 0xFFFFFFFF;
+    replayed.tick();
+
+    if (replayed.pos() != pos)
+      expected.push_back({timer, 0, replayed.pos(), 0});
+  }
+
+  ASSERT_TRUE(simulated.is_state(State::HALT));
+  ASSERT_LT(engine.now(), START); // It really went through the wrap point.
+  ASSERT_EQ(engine.trace().size(), expected.size());
+
+  for (unsigned short i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(engine.trace()[i].time, expected[i].time) << "sample " << i;
+    ASSERT_EQ(engine.trace()[i].pos, expected[i].pos) << "sample " << i;
+  }
+}
+
+TEST(Sim, should_schedule_a_scene_loaded_after_half_the_clock_range) {
+  using namespace ps;
+
+  unsigned long const START = 0x80000010;
+
+  sim::Engine engine(START);
+  PServo pservo(engine.timer());
+
+  pservo.load(SCENE, SCENE_COUNT); // The `_pc` is still zero.
+
+  ASSERT_EQ(sim::deadline(&pservo, START), START);
+  ASSERT_EQ(sim::deadline(&pservo, START + 1), START + 1);
+
+  engine.add(&pservo);
+
+  ASSERT_EQ(engine.next(), START);
+  ASSERT_EQ(engine.step(), 1);
+  ASSERT_EQ(pservo.pos(), 1);
+  ASSERT_EQ(engine.next(), START + 10);
+}
+
+TEST(Sim, should_run_a_ten_minutes_choreography_in_a_few_jumps) {
+  using namespace ps;
+
+  std::vector<Action> choreography;
+
+  for (unsigned char i = 0; i < 250; ++i)
+    choreography.push_back({(unsigned char)(i % 2 ? 0 : 180), 14});
+
+  sim::Engine engine;
+  PServo machine(engine.timer());
+
+  machine.load(choreography.data(), choreography.size());
+  engine.add(&machine);
+
+  unsigned long const end = engine.run();
+
+  ASSERT_TRUE(machine.is_state(State::HALT));
+  ASSERT_GE(end, 10ul * 60 * 1000);
+  ASSERT_LT(engine.ticks(), end / 10); // One per degree, plus the arrivals.
+  ASSERT_EQ(engine.trace().size(), 1 + 250 * 180);
+}
+
+TEST(Sim, should_keep_each_machine_in_its_own_trace) {
+  using namespace ps;
+
+  Action const fast[] = {{5, 2}};
+  Action const slow[] = {{3, 9}};
+
+  sim::Engine engine;
+
+  PServo a(engine.timer());
+  PServo b(engine.timer());
+
+  a.load(fast, 1);
+  b.load(slow, 1);
+
+  ASSERT_EQ(engine.add(&a), 0);
+  ASSERT_EQ(engine.add(&b), 1);
+  ASSERT_EQ(engine.run(), 28);
+
+  std::vector<sim::Sample> const trace_a = engine.trace(0);
+  std::vector<sim::Sample> const trace_b = engine.trace(1);
+
+  ASSERT_EQ(trace_a.size(), 6);
+  ASSERT_EQ(trace_a.back().time, 10);
+  ASSERT_EQ(trace_a.back().pos, 5);
+  ASSERT_EQ(trace_b.size(), 4);
+  ASSERT_EQ(trace_b.back().time, 27);
+  ASSERT_EQ(trace_b.back().pos, 3);
+
+  for (unsigned short i = 1; i < engine.trace().size(); ++i)
+    ASSERT_GE(engine.trace()[i].time, engine.trace()[i - 1].time);
+}
+
+TEST(Sim, should_stop_when_told_to) {
+  using namespace ps;
+
+  Action const wave[] = {{20, 5}, {0, 5}};
+
+  sim::Engine engine(1000);
+  PServo forever(engine.timer(), true);
+
+  forever.load(wave, 2);
+  engine.set_tracing(false);
+  engine.add(&forever);
+
+  ASSERT_LE(engine.run(61000), 61000);
+  ASSERT_GT(engine.now(), 60000);
+  ASSERT_TRUE(forever.is_state(State::IN_ACTION));
+  ASSERT_LE(engine.next(), 61005);
+  ASSERT_TRUE(engine.trace().empty());
+}
+
+TEST(Sim, should_do_nothing_without_scenes) {
+  using namespace ps;
+
+  sim::Engine engine;
+  PServo chained(engine.timer());
+
+  engine.add(&chained);
+
+  ASSERT_EQ(engine.next(), sim::Engine::NEVER);
+  ASSERT_EQ(engine.step(), 0);
+  ASSERT_EQ(engine.run(), 0);
+}
@@ -50,3 +50,66 @@ TEST(State, should_initialize_then_start_the_first_action) {
   pservo.move(30, 15);
   ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
 }
+
+TEST(State, should_start_the_first_action_when_the_count_is_declared) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, 0, 180, false);
+
+  pservo.begin(3);
+  ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
+  ASSERT_EQ(pservo.props().actions_count, 3);
+
+  timer += 15;
+
+  pservo.move(10, 15)->move(20, 15)->move(30, 15);
+  ASSERT_EQ(pservo.pos(), 1); // Moved on the very first loop routine.
+
+  pservo.begin(3);
+  ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
+  ASSERT_EQ(pservo.props().actions_count, 3);
+}
+
+TEST(State, should_be_in_error_state_when_zero_actions_are_declared) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo pservo(&timer, 0, 180, false);
+
+  pservo.begin(0);
+  ASSERT_EQ(pservo.get_state(), State::ERROR_NOACTION);
+}
+
+TEST(State, should_skip_the_counting_again_after_a_reset) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+
+  PServo counted(&timer, 0, 180, false);
+  PServo declared(&timer, 0, 180, false);
+
+  for (unsigned char scene = 0; scene < 3; ++scene) {
+    unsigned short counted_loops = 0;
+    unsigned short declared_loops = 0;
+
+    while (not counted.is_state(State::HALT)) {
+      ++timer;
+      ++counted_loops;
+      counted.begin()->move(scene % 2 == 0 ? 10 : 0, 2);
+    }
+
+    while (not declared.is_state(State::HALT)) {
+      ++timer;
+      ++declared_loops;
+      declared.begin(1)->move(scene % 2 == 0 ? 10 : 0, 2);
+    }
+
+    ASSERT_EQ(declared_loops + 1, counted_loops) << "scene " << (int)scene;
+
+    counted.reset();
+    declared.reset();
+  }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include "../../src/PServo.h"
+
+TEST(Tick, should_start_the_first_action_right_after_loading) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{5, 3}, {10, 3}, {15, 3}};
+
+  PServo pservo(&timer, 0, 180, false);
+
+  pservo.load(scene, 3);
+  ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
+  ASSERT_EQ(pservo.props().actions_count, 3);
+  ASSERT_EQ(pservo.props().active_action, 0);
+  ASSERT_EQ(pservo.active_action(), 0);
+  ASSERT_EQ(pservo.props().actions, scene);
+}
+
+TEST(Tick, should_be_in_error_state_when_no_actions_were_loaded) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{5, 3}};
+
+  PServo empty(&timer);
+
+  empty.tick();
+  ASSERT_EQ(empty.get_state(), State::ERROR_NOACTION);
+
+  PServo nothing(&timer);
+
+  nothing.load(scene, 0);
+  ASSERT_EQ(nothing.get_state(), State::ERROR_NOACTION);
+
+  nothing.tick();
+  ASSERT_EQ(nothing.get_state(), State::ERROR_NOACTION);
+}
+
+TEST(Tick, should_mirror_the_chained_api_on_every_loop) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{5, 3}, {5, 1}, {0, 2}, {12, 0}, {3, 4}};
+
+  for (bool const is_resetable : {false, true}) {
+    PServo chained(&timer, 0, 180, is_resetable);
+    PServo compiled(&timer, 0, 180, is_resetable);
+
+    timer = 0;
+    compiled.load(scene, 5);
+
+    chained.begin()->move(5, 3)->move(5, 1)->move(0, 2)->move(12, 0)->move(
+        3, 4); // Counting pass, the compiled scene doesn't need it.
+
+    for (unsigned short i = 0; i < 500; ++i) {
+      timer += i % 3; // Jittery loop, sometimes the time doesn't move at all.
+
+      chained.begin()->move(5, 3)->move(5, 1)->move(0, 2)->move(12, 0)->move(
+          3, 4);
+      compiled.tick();
+
+      ASSERT_EQ(compiled.get_state(), chained.get_state()) << "loop " << i;
+      ASSERT_EQ(compiled.pos(), chained.pos()) << "loop " << i;
+      ASSERT_EQ(compiled.props().pc, chained.props().pc) << "loop " << i;
+      ASSERT_EQ(compiled.props().active_action, chained.props().active_action)
+          << "loop " << i;
+    }
+  }
+}
+
+TEST(Tick, should_start_over_after_a_reset) {
+  using namespace ps;
+
+  unsigned long timer = 0;
+  Action const scene[] = {{2, 1}, {0, 1}};
+
+  PServo pservo(&timer, 0, 180, false);
+
+  pservo.load(scene, 2);
+
+  while (not pservo.is_state(State::HALT)) {
+    ++timer;
+    pservo.tick();
+  }
+
+  ASSERT_EQ(pservo.pos(), 0);
+
+  pservo.reset();
+  ASSERT_EQ(pservo.get_state(), State::STANDBY);
+  ASSERT_EQ(pservo.props().actions_count, 2);
+
+  pservo.tick();
+  ASSERT_EQ(pservo.get_state(), State::IN_ACTION);
+  ASSERT_EQ(pservo.props().active_action, 0);
+}
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../../src/Trace.h"
+#include "../host/FakeClock.h"
+#include "../host/TraceFile.h"
+
+namespace {
+// Takes at most `room` bytes on each write, like a busy serial port.
+class SlowSink : public ps::ByteSink {
+public:
+  SlowSink(unsigned short const room) : room(room) {}
+
+  unsigned short write(unsigned char const *const data,
+                       unsigned short const size) override {
+    unsigned short const taken = size < room ? size : room;
+
+    bytes.insert(bytes.end(), data, data + taken);
+    ++writes;
+
+    return taken;
+  }
+
+  unsigned short room;
+  unsigned long writes = 0;
+  std::vector<unsigned char> bytes;
+};
+}; // namespace
+
+TEST(Trace, should_record_and_decode_the_machines) {
+  using namespace ps;
+
+  Action const scene[] = {{10, 5}, {0, 5}};
+
+  sim::FakeClock clock(0xFFFFFF00); // The timestamps have 32 bits.
+
+  PServo a(clock);
+  PServo b(clock, 5, 180, false);
+
+  Trace<128> trace;
+  SlowSink sink(1000);
+
+  a.load(scene, 2);
+  b.load(scene, 2);
+
+  std::vector<trace::Record> expected;
+
+  for (unsigned char i = 0; i < 60; ++i, clock.advance(1)) {
+    a.tick();
+    b.tick();
+
+    ASSERT_TRUE(trace.record(clock.now(), 0, a));
+    ASSERT_TRUE(trace.record(clock.now(), 1, b));
+
+    expected.push_back({(uint32_t)clock.now(), 0, a.pos(), a.get_state(),
+                        a.props().active_action});
+    expected.push_back({(uint32_t)clock.now(), 1, b.pos(), b.get_state(),
+                        b.props().active_action});
+  }
+
+  ASSERT_EQ(trace.size(), 120);
+  ASSERT_EQ(trace.flush(sink), trace::HEADER_SIZE + 120 * trace::RECORD_SIZE);
+  ASSERT_EQ(trace.size(), 0);
+  ASSERT_EQ(sink.writes, 2); // The header, then every record at once.
+
+  std::vector<trace::Record> const records = trace::decode(sink.bytes);
+
+  ASSERT_EQ(records.size(), expected.size());
+
+  for (unsigned long i = 0; i < records.size(); ++i) {
+    ASSERT_EQ(records[i].time, expected[i].time) << "at " << i;
+    ASSERT_EQ(records[i].id, expected[i].id) << "at " << i;
+    ASSERT_EQ(records[i].pos, expected[i].pos) << "at " << i;
+    ASSERT_EQ(records[i].state, expected[i].state) << "at " << i;
+    ASSERT_EQ(records[i].action, expected[i].action) << "at " << i;
+  }
+}
+
+TEST(Trace, should_continue_records_sent_in_parts) {
+  using namespace ps;
+
+  Trace<4> trace;
+  SlowSink sink(3); // Never a whole record at once.
+
+  std::vector<trace::Record> expected;
+
+  for (unsigned short i = 0; i < 50; ++i) {
+    trace.record(1000 + i, i % 3, i, State::IN_ACTION, i / 10);
+    expected.push_back({1000u + i, (unsigned char)(i % 3), (unsigned char)i,
+                        State::IN_ACTION, (unsigned char)(i / 10)});
+
+    if (i % 2 == 0) // Slower than the recording, but it never drops.
+      continue;
+
+    while (trace.size() > 1)
+      trace.flush(sink);
+  }
+
+  while (trace.size() > 0)
+    trace.flush(sink);
+
+  ASSERT_EQ(trace.dropped(), 0);
+
+  std::vector<trace::Record> const records = trace::decode(sink.bytes);
+
+  ASSERT_EQ(records.size(), 50);
+
+  for (unsigned long i = 0; i < records.size(); ++i) {
+    ASSERT_EQ(records[i].time, expected[i].time) << "at " << i;
+    ASSERT_EQ(records[i].pos, expected[i].pos) << "at " << i;
+  }
+}
+
+TEST(Trace, should_drop_the_new_samples_when_full) {
+  using namespace ps;
+
+  Trace<8> trace;
+  SlowSink sink(0); // Busy.
+
+  for (unsigned char i = 0; i < 8; ++i)
+    ASSERT_TRUE(trace.record(i, 0, i, State::IN_ACTION, 0));
+
+  ASSERT_FALSE(trace.record(8, 0, 8, State::IN_ACTION, 0));
+  ASSERT_FALSE(trace.record(9, 0, 9, State::IN_ACTION, 0));
+  ASSERT_EQ(trace.flush(sink), 0);
+  ASSERT_EQ(trace.dropped(), 2);
+  ASSERT_EQ(trace.size(), trace.capacity());
+
+  sink.room = 1000;
+
+  ASSERT_EQ(trace.flush(sink), trace::HEADER_SIZE + 8 * trace::RECORD_SIZE);
+
+  std::vector<trace::Record> const records = trace::decode(sink.bytes);
+
+  ASSERT_EQ(records.size(), 8);
+  ASSERT_EQ(records.back().pos, 7); // The oldest ones were kept.
+}
+
+TEST(Trace, should_not_decode_other_formats) {
+  using namespace ps;
+
+  std::vector<unsigned char> const scene = {'P', 'S', 1, 0, 90, 10, 0, 0};
+  std::vector<unsigned char> const cut = {'P', 'T', 1, 0, 1, 2, 3};
+
+  ASSERT_TRUE(trace::decode(scene).empty());
+  ASSERT_TRUE(trace::decode(cut).empty());
+  ASSERT_TRUE(trace::decode({}).empty());
+}
+
+TEST(Trace, should_write_csv_and_timelines) {
+  using namespace ps;
+
+  std::vector<trace::Record> const records = {
+      {0, 0, 0, State::IN_ACTION, 0},   {0, 1, 90, State::IN_ACTION, 0},
+      {10, 0, 5, State::IN_ACTION, 0},  {10, 1, 91, State::IN_ACTION, 1},
+      {20, 0, 10, State::IN_ACTION, 1}, {20, 1, 92, State::HALT, 1},
+      {30, 0, 10, State::HALT, 1},
+  };
+
+  ASSERT_EQ(trace::csv({records[0], records[5]}),
+            "time,id,pos,state,action\n"
+            "0,0,0,IN_ACTION,0\n"
+            "20,1,92,HALT,1\n");
+
+  ASSERT_EQ(trace::timeline(records), "#0 0..10 IN_ACTION action 0, 0 -> 5\n"
+                                      "#0 20..20 IN_ACTION action 1, 10 -> 10\n"
+                                      "#0 30..30 HALT action 1, 10 -> 10\n"
+                                      "#1 0..0 IN_ACTION action 0, 90 -> 90\n"
+                                      "#1 10..10 IN_ACTION action 1, 91 -> 91\n"
+                                      "#1 20..20 HALT action 1, 92 -> 92\n");
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "../../src/Scheduler.h"
+#include "../../src/ServoBank.h"
+#include "../host/FakeClock.h"
+
+namespace {
+// Just like `micros()` on the boards, a 32 bits counter.
+unsigned long const WRAP = 0xFFFFFFFFul;
+unsigned long const START = WRAP - 500;
+
+unsigned long wrapped(unsigned long const time) { return time & WRAP; }
+}; // namespace
+
+TEST(Wrap, should_measure_the_time_across_the_wrap_point) {
+  using namespace ps;
+
+  EXPECT_EQ(elapsed(0xFFFFFFF0ul, 0x10ul), 0x20);
+  EXPECT_EQ(elapsed(10, 25), 15);
+  EXPECT_EQ(elapsed(WRAP, 0), 1);
+}
+
+TEST(Wrap, should_move_the_same_across_the_wrap_point) {
+  using namespace ps;
+
+  Action const scene[] = {
+      {90, 7},
+      {30, 600, Profile::SCURVE},
+      {60, 3},
+      {0, 400, Profile::LINEAR},
+  };
+
+  unsigned long linear = START;
+  unsigned long timer = START;
+
+  PServo reference(&linear);
+  PServo wrapping(&timer);
+  PServo smooth_reference(&linear);
+  PServo smooth(&timer);
+
+  reference.load(scene, 4);
+  wrapping.load(scene, 4);
+  smooth_reference.set_high_res(true);
+  smooth_reference.load(scene, 4);
+  smooth.set_high_res(true);
+  smooth.load(scene, 4);
+
+  for (; reference.is_state(State::IN_ACTION) or
+         smooth_reference.is_state(State::IN_ACTION);
+       ++linear) {
+    timer = wrapped(linear);
+
+    reference.tick();
+    wrapping.tick();
+    smooth_reference.tick();
+    smooth.tick();
+
+    ASSERT_EQ(wrapping.pos(), reference.pos()) << "at " << timer;
+    ASSERT_EQ(smooth.pos_us(), smooth_reference.pos_us()) << "at " << timer;
+  }
+
+  ASSERT_GT(linear, WRAP); // It really went through the wrap point.
+  ASSERT_TRUE(wrapping.is_state(State::HALT));
+  ASSERT_TRUE(smooth.is_state(State::HALT));
+}
+
+TEST(Wrap, should_catch_up_across_the_wrap_point) {
+  using namespace ps;
+
+  sim::FakeClock clock(START);
+
+  PServo pservo(clock);
+
+  pservo.set_catch_up(true);
+
+  for (unsigned char i = 0; i < 10; ++i) {
+    clock.set(wrapped(clock.now() + 100)); // A slow loop, in microseconds.
+    pservo.begin(1)->move(180, 10);
+  }
+
+  ASSERT_EQ(pservo.pos(), 90);
+}
+
+TEST(Wrap, should_schedule_across_the_wrap_point) {
+  using namespace ps;
+
+  Action const scene[] = {{10, 300}};
+  unsigned long timer = START;
+
+  PServo pservo(&timer);
+  Scheduler<1> scheduler(&timer);
+
+  pservo.load(scene, 1)->tick(); // First step right away.
+  ASSERT_TRUE(scheduler.add(&pservo));
+
+  timer = START + 299;
+  ASSERT_EQ(scheduler.until_next(), 1);
+  ASSERT_EQ(scheduler.run(), 0);
+
+  timer = START + 300;
+  ASSERT_EQ(scheduler.run(), 1);
+
+  timer = wrapped(START + 599); // The next deadline is after the wrap.
+  ASSERT_LT(timer, START);
+  ASSERT_EQ(scheduler.until_next(), 1);
+  ASSERT_EQ(scheduler.run(), 0);
+
+  timer = wrapped(START + 600);
+  ASSERT_EQ(scheduler.run(), 1);
+  ASSERT_EQ(pservo.pos(), 3);
+}
+
+TEST(Wrap, should_step_a_bank_across_the_wrap_point) {
+  using namespace ps;
+
+  Action const scene[] = {{100, 9}};
+  unsigned long timer = START;
+
+  ServoBank<4> bank(&timer);
+
+  for (unsigned short i = 0; i < 4; ++i)
+    bank.load(i, scene, 1);
+
+  for (unsigned long linear = START; linear < START + 1000; ++linear) {
+    timer = wrapped(linear);
+    bank.tick();
+  }
+
+  for (unsigned short i = 0; i < 4; ++i)
+    ASSERT_EQ(bank.pos(i), 100);
+}
+
+TEST(Wrap, should_sweep_fast_with_microseconds) {
+  using namespace ps;
+
+  sim::FakeClock clock(START);
+
+  PServo pservo(clock);
+
+  // 180 deg in 9 ms, a bit faster than the 1 deg/ms limit of `millis()`.
+  pservo.set_catch_up(true);
+
+  for (unsigned short i = 0; i <= 451; ++i) { // A 20 us loop.
+    pservo.begin(1)->move(180, 50);
+    clock.set(wrapped(clock.now() + 20));
+  }
+
+  ASSERT_EQ(pservo.pos(), 180);
+}
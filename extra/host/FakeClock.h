@@ -0,0 +1,44 @@
+#pragma once
+
+/*!
+ * Host only clock for tests and simulations, it only moves when told to.
+ */
+
+#include "../../src/Clock.h"
+
+namespace ps {
+namespace sim {
+/*!
+ * For an example:
+ * ```cpp
+ * ps::sim::FakeClock clock;
+ * ps::PServo machine(clock);
+ *
+ * clock.advance(10);
+ * machine.tick();
+ * ```
+ */
+class FakeClock : public Clock {
+public:
+  /*!
+   * @param start Initial time.
+   */
+  FakeClock(unsigned long const start = 0) : _now(start) {}
+
+  unsigned long now(void) const override { return _now; }
+
+  /*!
+   * @param time The new current time, it can also go backwards.
+   */
+  void set(unsigned long const time) { _now = time; }
+
+  /*!
+   * @param amount How much time should pass.
+   */
+  void advance(unsigned long const amount) { _now += amount; }
+
+private:
+  unsigned long _now;
+};
+}; // namespace sim
+}; // namespace ps
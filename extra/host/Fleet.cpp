@@ -0,0 +1,195 @@
+#include "Fleet.h"
+
+#include <algorithm>
+
+unsigned long constexpr ps::sim::Fleet::NEVER;
+
+namespace {
+// Small enough to balance uneven scenes, big enough to not fight over the
+// shared counter.
+unsigned long const CHUNK = 64;
+
+// Spins for a while, since the next instant is usually a few microseconds
+// away, then sleeps -- so it also behaves with less cores than threads.
+template <typename F>
+void wait_until(std::mutex &mutex, std::condition_variable &signal,
+                F const &is_done) {
+  for (unsigned short spins = 0; spins < 1024; ++spins) {
+    if (is_done())
+      return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex);
+
+  signal.wait(lock, is_done);
+}
+
+void wake_up(std::mutex &mutex, std::condition_variable &signal) {
+  std::lock_guard<std::mutex> const lock(mutex);
+
+  signal.notify_all();
+}
+}; // namespace
+
+ps::sim::Fleet::Fleet(unsigned short const threads, unsigned long const start)
+    : _now(start), _partials(threads < 1 ? 1 : threads) {
+  for (unsigned short worker = 1; worker < _partials.size(); ++worker)
+    _pool.emplace_back(&Fleet::_loop, this, worker);
+}
+
+ps::sim::Fleet::~Fleet(void) {
+  _is_stopping.store(true, std::memory_order_release);
+  _generation.fetch_add(1, std::memory_order_release);
+  wake_up(_mutex, _started);
+
+  for (std::thread &thread : _pool)
+    thread.join();
+}
+
+unsigned long *ps::sim::Fleet::timer(void) { return &_now; }
+
+unsigned long ps::sim::Fleet::now(void) const { return _now; }
+
+unsigned short ps::sim::Fleet::add(ps::PServo *const machine) {
+  unsigned short const id = _machines.size();
+
+  _machines.push_back(machine);
+  _deadline.push_back(deadline(machine, _now));
+  _traces.emplace_back();
+  _record(id);
+
+  _next = sooner(_now, _next, _deadline[id]);
+
+  return id;
+}
+
+unsigned long ps::sim::Fleet::next(void) const { return _next; }
+
+unsigned long ps::sim::Fleet::step(void) {
+  if (_next == NEVER)
+    return 0;
+
+  _now = (uint32_t)(is_before_or_at(_next, _now) ? _now : _next); // Wraps.
+  _cursor.store(0, std::memory_order_relaxed);
+  _finished.store(0, std::memory_order_relaxed);
+  _generation.fetch_add(1, std::memory_order_release);
+  wake_up(_mutex, _started);
+
+  _work(0);
+
+  wait_until(_mutex, _done, [this] {
+    return _finished.load(std::memory_order_acquire) == _pool.size();
+  });
+
+  unsigned long ticked = 0;
+
+  _next = NEVER;
+
+  for (Partial const &partial : _partials) {
+    _next = sooner(_now, _next, partial.next);
+    ticked += partial.ticked;
+  }
+
+  _ticks += ticked;
+
+  return ticked;
+}
+
+unsigned long ps::sim::Fleet::run(unsigned long const until) {
+  while (_next != NEVER and (until == NEVER or is_before_or_at(_next, until)))
+    step();
+
+  return _now;
+}
+
+unsigned long ps::sim::Fleet::ticks(void) const { return _ticks; }
+
+unsigned short ps::sim::Fleet::threads(void) const { return _partials.size(); }
+
+void ps::sim::Fleet::set_tracing(bool const is_tracing) {
+  _is_tracing = is_tracing;
+}
+
+std::vector<ps::sim::Sample> const &
+ps::sim::Fleet::trace(unsigned short const id) const {
+  return _traces[id];
+}
+
+std::vector<ps::sim::Sample> ps::sim::Fleet::trace(void) const {
+  std::vector<Sample> samples;
+
+  for (std::vector<Sample> const &machine : _traces)
+    samples.insert(samples.end(), machine.begin(), machine.end());
+
+  std::stable_sort(samples.begin(), samples.end(),
+                   [](Sample const &a, Sample const &b) {
+                     if (a.time == b.time)
+                       return a.id < b.id;
+
+                     return not is_before_or_at(b.time, a.time); // Wraps.
+                   });
+
+  return samples;
+}
+
+void ps::sim::Fleet::_work(unsigned short const worker) {
+  unsigned long const count = _machines.size();
+  unsigned long next = NEVER;
+  unsigned long ticked = 0;
+
+  for (;;) {
+    unsigned long const begin =
+        _cursor.fetch_add(CHUNK, std::memory_order_relaxed);
+
+    if (begin >= count)
+      break;
+
+    unsigned long const end = std::min(begin + CHUNK, count);
+
+    for (unsigned long id = begin; id < end; ++id) {
+      if (_deadline[id] != NEVER and is_before_or_at(_deadline[id], _now)) {
+        bool const is_changed = tick(_machines[id]);
+
+        ++ticked;
+
+        if (is_changed)
+          _record(id);
+
+        _deadline[id] = deadline(_machines[id], _now + 1);
+      }
+
+      next = sooner(_now, next, _deadline[id]);
+    }
+  }
+
+  _partials[worker].next = next;
+  _partials[worker].ticked = ticked;
+}
+
+void ps::sim::Fleet::_loop(unsigned short const worker) {
+  for (unsigned long seen = 0;;) {
+    wait_until(_mutex, _started, [this, seen] {
+      return _generation.load(std::memory_order_acquire) != seen;
+    });
+
+    seen = _generation.load(std::memory_order_acquire);
+
+    if (_is_stopping.load(std::memory_order_acquire))
+      return;
+
+    _work(worker);
+
+    unsigned short const finished =
+        _finished.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    if (finished == _pool.size()) // The last one wakes up the caller.
+      wake_up(_mutex, _done);
+  }
+}
+
+void ps::sim::Fleet::_record(unsigned short const id) {
+  if (not _is_tracing)
+    return;
+
+  _traces[id].push_back(sample(_now, id, _machines[id]));
+}
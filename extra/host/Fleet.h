@@ -0,0 +1,163 @@
+#pragma once
+
+/*!
+ * Multi-threaded version of `ps::sim::Engine`, for fleets of thousands of
+ * machines. The machines are split into small chunks that the threads claim
+ * from a shared counter, so a thread that gets the cheap chunks just takes
+ * more of them, and every thread waits for the others before the clock moves
+ * again -- all machines advance in lockstep, one virtual instant at a time.
+ *
+ * Each machine is only touched by one thread per instant, and the clock is
+ * only changed between instants, so the result doesn't depend on how the work
+ * was split: the traces are the same ones of a single threaded run.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Sim.h"
+
+namespace ps {
+namespace sim {
+/*!
+ * Drives a set of machines running compiled or streamed scenes, same as the
+ * `ps::sim::Engine`, but spread across a pool of threads.
+ *
+ * For an example:
+ * ```cpp
+ * ps::sim::Fleet fleet(std::thread::hardware_concurrency());
+ * std::vector<ps::PServo> machines(4096, ps::PServo(fleet.timer()));
+ *
+ * for (ps::PServo &m : machines) {
+ *   m.load(scene, count);
+ *   fleet.add(&m);
+ * }
+ *
+ * fleet.run();
+ * ```
+ */
+class Fleet {
+public:
+  /*!
+   * Value of `Fleet::next()` when there is nothing else to do.
+   */
+  static unsigned long constexpr NEVER = Engine::NEVER;
+
+  /*!
+   * @param threads How much threads should work, the calling one included.
+   * @param start Initial value of the virtual clock.
+   */
+  Fleet(unsigned short const threads, unsigned long const start = 0);
+  ~Fleet(void);
+
+  Fleet(Fleet const &) = delete;
+  Fleet &operator=(Fleet const &) = delete;
+
+  /*!
+   * @returns Pointer to the virtual clock, pass it to the machines.
+   */
+  unsigned long *timer(void);
+
+  /*!
+   * @returns Current value of the virtual clock.
+   */
+  unsigned long now(void) const;
+
+  /*!
+   * Registers a machine, its current position is recorded right away. It
+   * should use the fleet's timer, and it can't be added while running.
+   *
+   * @param machine Machine running a compiled or streamed scene.
+   *
+   * @returns The machine index, used on the trace samples.
+   */
+  unsigned short add(PServo *const machine);
+
+  /*!
+   * @returns When the next machine will be due, or `Fleet::NEVER` when all of
+   * them are done.
+   */
+  unsigned long next(void) const;
+
+  /*!
+   * Jumps the clock to the next deadline and ticks, in parallel, every machine
+   * that is due by then.
+   *
+   * @returns How much machines were updated, `0` if there is nothing to do.
+   */
+  unsigned long step(void);
+
+  /*!
+   * Keeps stepping until every machine is done, or until the clock would go
+   * past the `until` time.
+   *
+   * @param until Maximum value of the virtual clock.
+   *
+   * @returns The clock value when it stopped.
+   */
+  unsigned long run(unsigned long const until = NEVER);
+
+  /*!
+   * @returns How much `ps::PServo::tick()` calls were made so far.
+   */
+  unsigned long ticks(void) const;
+
+  /*!
+   * @returns How much threads are working, the calling one included.
+   */
+  unsigned short threads(void) const;
+
+  /*!
+   * Enables or disables the recording of samples, enabled by default.
+   *
+   * @param is_tracing Should the position changes be recorded.
+   */
+  void set_tracing(bool const is_tracing);
+
+  /*!
+   * @param id Index of the machine.
+   *
+   * @returns The samples of that machine, sorted by time.
+   */
+  std::vector<Sample> const &trace(unsigned short const id) const;
+
+  /*!
+   * @returns Every recorded sample, sorted by time and then by machine.
+   */
+  std::vector<Sample> trace(void) const;
+
+private:
+  // Results of a thread on each instant, on its own cache line.
+  struct alignas(64) Partial {
+    unsigned long next;
+    unsigned long ticked;
+  };
+
+  unsigned long _now;
+  unsigned long _next = NEVER;
+  unsigned long _ticks = 0;
+  bool _is_tracing = true;
+
+  std::vector<PServo *> _machines;
+  std::vector<unsigned long> _deadline; // `NEVER` for the finished ones.
+  std::vector<std::vector<Sample>> _traces;
+
+  std::vector<std::thread> _pool;
+  std::vector<Partial> _partials;
+  std::atomic<unsigned long> _generation{0};
+  std::atomic<unsigned long> _cursor{0};
+  std::atomic<unsigned short> _finished{0};
+  std::atomic<bool> _is_stopping{false};
+  std::mutex _mutex;
+  std::condition_variable _started;
+  std::condition_variable _done;
+
+  void _work(unsigned short const worker);
+  void _loop(unsigned short const worker);
+  void _record(unsigned short const id);
+};
+}; // namespace sim
+}; // namespace ps
@@ -0,0 +1,50 @@
+#include "MappedScene.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+ps::binary::MappedScene::MappedScene(char const *const path) {
+  int const fd = open(path, O_RDONLY);
+  struct stat info;
+
+  if (fd < 0)
+    return;
+
+  if (fstat(fd, &info) == 0 and info.st_size > 0) {
+    void *const data =
+        mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (data != MAP_FAILED) {
+      madvise(data, info.st_size, MADV_SEQUENTIAL); // Played in order, once.
+
+      _data = (unsigned char const *)data;
+      _size = info.st_size;
+    }
+  }
+
+  close(fd); // The mapping stays valid without it.
+}
+
+ps::binary::MappedScene::~MappedScene(void) {
+  if (_data != nullptr)
+    munmap((void *)_data, _size);
+}
+
+bool ps::binary::MappedScene::is_open(void) const { return _data != nullptr; }
+
+ps::MemorySource ps::binary::MappedScene::bytes(void) const {
+  return MemorySource(_data, _size);
+}
+
+unsigned long ps::binary::MappedScene::count(void) const {
+  using namespace ps;
+
+  if (_size < format::HEADER_SIZE)
+    return 0;
+
+  return (_size - format::HEADER_SIZE) / format::RECORD_SIZE;
+}
+
+unsigned long ps::binary::MappedScene::size(void) const { return _size; }
@@ -0,0 +1,61 @@
+#pragma once
+
+/*!
+ * Host only, read-only view of a binary scene file (see `ps::format`) mapped
+ * straight into memory with `mmap()`. Opening a scene doesn't read, copy or
+ * allocate anything for its actions, so it costs the same for a scene with ten
+ * actions or a million of them -- the pages are only loaded by the system when
+ * the `ps::ScenePlayer` gets to them.
+ *
+ * For an example:
+ * ```cpp
+ * ps::binary::MappedScene scene("choreography.bin");
+ * ps::MemorySource bytes = scene.bytes();
+ * ps::ScenePlayer player(&bytes);
+ *
+ * machine.play(&player);
+ * ```
+ */
+
+#include "../../src/ScenePlayer.h"
+
+namespace ps {
+namespace binary {
+class MappedScene {
+public:
+  /*!
+   * @param path Scene file to be mapped, check `MappedScene::is_open()` after.
+   */
+  MappedScene(char const *const path);
+  ~MappedScene(void);
+
+  MappedScene(MappedScene const &) = delete;
+  MappedScene &operator=(MappedScene const &) = delete;
+
+  /*!
+   * @returns Was the file mapped? Empty files can't be mapped.
+   */
+  bool is_open(void) const;
+
+  /*!
+   * @returns A new source over the mapped bytes, each machine playing this
+   * scene should have its own. It's empty if the file is not open.
+   */
+  MemorySource bytes(void) const;
+
+  /*!
+   * @returns How much actions there are in the file, from its size only.
+   */
+  unsigned long count(void) const;
+
+  /*!
+   * @returns Size of the mapped file, in bytes.
+   */
+  unsigned long size(void) const;
+
+private:
+  unsigned char const *_data = nullptr;
+  unsigned long _size = 0;
+};
+}; // namespace binary
+}; // namespace ps
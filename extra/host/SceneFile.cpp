@@ -0,0 +1,71 @@
+#include "SceneFile.h"
+
+std::vector<unsigned char> ps::binary::encode(ps::Action const *const actions,
+                                              unsigned long const count) {
+  using namespace ps;
+
+  std::vector<unsigned char> bytes = {format::MAGIC_0, format::MAGIC_1,
+                                      format::VERSION, 0};
+
+  bytes.reserve(format::HEADER_SIZE + count * format::RECORD_SIZE);
+
+  for (unsigned long i = 0; i < count; ++i) {
+    bytes.push_back(actions[i].pos);
+    bytes.push_back(actions[i].delay & 0xFF);
+    bytes.push_back(actions[i].delay >> 8);
+    bytes.push_back((unsigned char)actions[i].profile);
+  }
+
+  return bytes;
+}
+
+std::vector<ps::Action>
+ps::binary::decode(std::vector<unsigned char> const &bytes) {
+  using namespace ps;
+
+  MemorySource source(bytes.data(), bytes.size());
+  ScenePlayer player(&source);
+  std::vector<Action> actions;
+
+  for (Action action; player.next(&action);)
+    actions.push_back(action);
+
+  return actions;
+}
+
+bool ps::binary::save(char const *const path, ps::Action const *const actions,
+                      unsigned long const count) {
+  std::vector<unsigned char> const bytes = encode(actions, count);
+  std::FILE *const file = std::fopen(path, "wb");
+
+  if (file == nullptr)
+    return false;
+
+  bool const is_written =
+      std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+
+  return std::fclose(file) == 0 and is_written;
+}
+
+ps::binary::FileSource::FileSource(char const *const path)
+    : _file(std::fopen(path, "rb")) {}
+
+ps::binary::FileSource::~FileSource(void) {
+  if (_file != nullptr)
+    std::fclose(_file);
+}
+
+int ps::binary::FileSource::read(void) {
+  if (_file == nullptr)
+    return -1;
+
+  int const byte = std::fgetc(_file);
+
+  return byte == EOF ? -1 : byte;
+}
+
+bool ps::binary::FileSource::rewind(void) {
+  return _file != nullptr and std::fseek(_file, 0, SEEK_SET) == 0;
+}
+
+bool ps::binary::FileSource::is_open(void) const { return _file != nullptr; }
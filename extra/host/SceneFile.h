@@ -0,0 +1,72 @@
+#pragma once
+
+/*!
+ * Host only tools for the binary scene format (see `ps::format`), used to build
+ * the scenes that a `ps::ScenePlayer` streams on the board -- as a file to be
+ * sent through the serial port, or as a C array to be stored with `PROGMEM`.
+ */
+
+#include <cstdio>
+#include <vector>
+
+#include "../../src/ScenePlayer.h"
+
+namespace ps {
+namespace binary {
+/*!
+ * @param actions Table with the actions of the scene.
+ * @param count How much actions there are in the table.
+ *
+ * @returns The encoded scene, header included.
+ */
+std::vector<unsigned char> encode(Action const *const actions,
+                                  unsigned long const count);
+
+/*!
+ * Decodes a whole scene at once, with a `ps::ScenePlayer`.
+ *
+ * @param bytes The encoded scene, header included.
+ *
+ * @returns Every action of the scene, or less if a record was not valid.
+ */
+std::vector<Action> decode(std::vector<unsigned char> const &bytes);
+
+/*!
+ * Encodes a scene straight into a file.
+ *
+ * @param path Where the file should be written to.
+ * @param actions Table with the actions of the scene.
+ * @param count How much actions there are in the table.
+ *
+ * @returns `false` if the file could not be written.
+ */
+bool save(char const *const path, Action const *const actions,
+          unsigned long const count);
+
+/*!
+ * Bytes read from a file, one at a time. It's rewound with `fseek()`.
+ */
+class FileSource : public ByteSource {
+public:
+  /*!
+   * @param path File to be read, check `FileSource::is_open()` after.
+   */
+  FileSource(char const *const path);
+  ~FileSource(void);
+
+  FileSource(FileSource const &) = delete;
+  FileSource &operator=(FileSource const &) = delete;
+
+  int read(void) override;
+  bool rewind(void) override;
+
+  /*!
+   * @returns Was the file opened?
+   */
+  bool is_open(void) const;
+
+private:
+  std::FILE *_file = nullptr;
+};
+}; // namespace binary
+}; // namespace ps
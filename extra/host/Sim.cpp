@@ -0,0 +1,132 @@
+#include "Sim.h"
+
+unsigned long constexpr ps::sim::Engine::NEVER;
+
+unsigned long ps::sim::deadline(ps::PServo const *const machine,
+                                unsigned long const earliest) {
+  using namespace ps;
+
+  bool const is_running = machine->is_state(State::IN_ACTION) or
+                          machine->is_state(State::STANDBY) or
+                          machine->is_state(State::INITIALIZED);
+
+  if (not is_running or not machine->has_scene())
+    return NEVER;
+
+  unsigned long const due = machine->due();
+
+  return is_before_or_at(due, earliest) ? earliest : due;
+}
+
+unsigned long ps::sim::sooner(unsigned long const now, unsigned long const a,
+                              unsigned long const b) {
+  if (a == NEVER or b == NEVER)
+    return a == NEVER ? b : a;
+
+  return elapsed(now, a) <= elapsed(now, b) ? a : b;
+}
+
+bool ps::sim::tick(ps::PServo *const machine) {
+  unsigned char const pos = machine->pos();
+  unsigned char const frac = machine->frac();
+
+  machine->tick();
+
+  return machine->pos() != pos or machine->frac() != frac;
+}
+
+ps::sim::Sample ps::sim::sample(unsigned long const time,
+                                unsigned short const id,
+                                ps::PServo const *const machine) {
+  return Sample{time, id, machine->pos(), machine->frac()};
+}
+
+ps::sim::Engine::Engine(unsigned long const start) : _now(start) {}
+
+unsigned long *ps::sim::Engine::timer(void) { return &_now; }
+
+unsigned long ps::sim::Engine::now(void) const { return _now; }
+
+unsigned short ps::sim::Engine::add(ps::PServo *const machine) {
+  unsigned short const id = _machines.size();
+
+  _machines.push_back(machine);
+  _deadline.push_back(deadline(machine, _now));
+  _record(id);
+
+  return id;
+}
+
+unsigned long ps::sim::Engine::next(void) const {
+  unsigned long first = NEVER;
+
+  for (unsigned long const d : _deadline)
+    first = sooner(_now, first, d);
+
+  return first;
+}
+
+unsigned short ps::sim::Engine::step(void) {
+  unsigned long const at = next();
+  unsigned short ticked = 0;
+
+  if (at == NEVER)
+    return 0;
+
+  _now = (uint32_t)(is_before_or_at(at, _now) ? _now : at); // Wraps around.
+
+  for (unsigned short id = 0; id < _machines.size(); ++id) {
+    if (_deadline[id] == NEVER or not is_before_or_at(_deadline[id], _now))
+      continue;
+
+    bool const is_changed = tick(_machines[id]);
+
+    ++_ticks;
+    ++ticked;
+
+    if (is_changed)
+      _record(id);
+
+    _deadline[id] = deadline(_machines[id], _now + 1);
+  }
+
+  return ticked;
+}
+
+unsigned long ps::sim::Engine::run(unsigned long const until) {
+  for (unsigned long at = next();
+       at != NEVER and (until == NEVER or is_before_or_at(at, until));
+       at = next())
+    step();
+
+  return _now;
+}
+
+unsigned long ps::sim::Engine::ticks(void) const { return _ticks; }
+
+void ps::sim::Engine::set_tracing(bool const is_tracing) {
+  _is_tracing = is_tracing;
+}
+
+std::vector<ps::sim::Sample> const &ps::sim::Engine::trace(void) const {
+  return _trace;
+}
+
+std::vector<ps::sim::Sample>
+ps::sim::Engine::trace(unsigned short const id) const {
+  std::vector<Sample> samples;
+
+  for (Sample const &s : _trace) {
+    if (s.id == id)
+      samples.push_back(s);
+  }
+
+  return samples;
+}
+
+void ps::sim::Engine::_record(unsigned short const id) {
+  if (not _is_tracing)
+    return;
+
+  _trace.push_back(sample(_now, id, _machines[id]));
+}
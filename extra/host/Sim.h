@@ -0,0 +1,208 @@
+#pragma once
+
+/*!
+ * Host only simulation of many `ps::PServo` machines against a virtual clock.
+ * Instead of advancing the timer one millisecond at a time, like a real
+ * `loop()` would, the engine jumps straight to the next deadline of the
+ * registered machines (see `ps::PServo::due()`), so a scene that takes minutes
+ * on the board runs in a few milliseconds. The result is the same as ticking
+ * every machine on every millisecond.
+ *
+ * Every position change is recorded into a trace, that can be inspected after
+ * (or during) the run.
+ *
+ * Just like the `millis()` function, the virtual clock wraps around after 32
+ * bits, and the deadlines are compared in an overflow safe way (see
+ * `ps::elapsed()`).
+ */
+
+#include <vector>
+
+#include "../../src/PServo.h"
+
+namespace ps {
+namespace sim {
+/*!
+ * A deadline that never comes, of the machines that are done -- they halted,
+ * ended up in an error state, or have no scene at all.
+ */
+unsigned long constexpr NEVER = ~0ul;
+
+/*!
+ * Overflow safe `a <= b`, the same comparison that the `ps::Scheduler` uses,
+ * as long as both are less than half the range of a 32 bits timer apart.
+ *
+ * @param a The time that should come first.
+ * @param b The other time.
+ *
+ * @returns Is `a` before, or at the same time of, `b`?
+ */
+inline bool is_before_or_at(unsigned long const a, unsigned long const b) {
+  return (int32_t)elapsed(b, a) <= 0;
+}
+
+/*!
+ * A single position change of a machine.
+ */
+typedef struct Sample {
+  unsigned long time; //!< Virtual time of the change.
+  unsigned short id;  //!< Index of the machine, as returned by `Engine::add()`.
+  unsigned char pos;  //!< The new position.
+  unsigned char frac; //!< Fraction of degree, on the high resolution mode.
+} Sample;
+
+/*!
+ * When a machine should be updated next, used by both the `ps::sim::Engine`
+ * and the `ps::sim::Fleet`. A machine is never updated twice on the same
+ * instant, just like a real loop that takes, at least, one time unit.
+ *
+ * @param machine The machine to be scheduled.
+ * @param earliest The deadline is never before it.
+ *
+ * @returns The next deadline, or `ps::sim::NEVER` when it's done.
+ */
+unsigned long deadline(PServo const *const machine,
+                       unsigned long const earliest);
+
+/*!
+ * @param now Current value of the virtual clock.
+ * @param a A deadline, or `ps::sim::NEVER`.
+ * @param b Another one.
+ *
+ * @returns The one that is closest ahead of the clock, since none of them are
+ * behind it.
+ */
+unsigned long sooner(unsigned long const now, unsigned long const a,
+                     unsigned long const b);
+
+/*!
+ * Ticks a machine, same as `ps::PServo::tick()`.
+ *
+ * @param machine The machine to be updated.
+ *
+ * @returns Has its position, or the fraction of degree, changed?
+ */
+bool tick(PServo *const machine);
+
+/*!
+ * @param time Current value of the virtual clock.
+ * @param id Index of the machine.
+ * @param machine The machine itself.
+ *
+ * @returns A sample with the current position of the machine.
+ */
+Sample sample(unsigned long const time, unsigned short const id,
+              PServo const *const machine);
+
+/*!
+ * Drives a set of machines running compiled scenes (`ps::PServo::load()`).
+ * Every machine should be created with the engine's timer.
+ *
+ * For an example:
+ * ```cpp
+ * ps::sim::Engine engine;
+ * ps::PServo machine(engine.timer(), 0, 180, false);
+ *
+ * machine.load(choreography, count);
+ * engine.add(&machine);
+ *
+ * unsigned long const end = engine.run();
+ *
+ * for (ps::sim::Sample const &s : engine.trace())
+ *   printf("%lu,%d\n", s.time, s.pos);
+ * ```
+ */
+class Engine {
+public:
+  /*!
+   * Value of `Engine::next()` when there is nothing else to do.
+   */
+  static unsigned long constexpr NEVER = sim::NEVER;
+
+  /*!
+   * @param start Initial value of the virtual clock.
+   */
+  Engine(unsigned long const start = 0);
+
+  /*!
+   * @returns Pointer to the virtual clock, pass it to the machines.
+   */
+  unsigned long *timer(void);
+
+  /*!
+   * @returns Current value of the virtual clock.
+   */
+  unsigned long now(void) const;
+
+  /*!
+   * Registers a machine, its current position is recorded right away. It
+   * should use the engine's timer, and it should not be added twice.
+   *
+   * @param machine Machine running a compiled scene.
+   *
+   * @returns The machine index, used on the trace samples.
+   */
+  unsigned short add(PServo *const machine);
+
+  /*!
+   * @returns When the next machine will be due, or `Engine::NEVER` when all of
+   * them has halted (or ended up in an error state).
+   */
+  unsigned long next(void) const;
+
+  /*!
+   * Jumps the clock to the next deadline and ticks every machine that is due
+   * by then, in the order they were added.
+   *
+   * @returns How much machines were updated, `0` if there is nothing to do.
+   */
+  unsigned short step(void);
+
+  /*!
+   * Keeps stepping until every machine is done, or until the clock would go
+   * past the `until` time -- a resetable machine never ends.
+   *
+   * @param until Maximum value of the virtual clock.
+   *
+   * @returns The clock value when it stopped.
+   */
+  unsigned long run(unsigned long const until = NEVER);
+
+  /*!
+   * @returns How much `ps::PServo::tick()` calls were made so far.
+   */
+  unsigned long ticks(void) const;
+
+  /*!
+   * Enables or disables the recording of samples, enabled by default. Long
+   * runs with many machines can use a lot of memory.
+   *
+   * @param is_tracing Should the position changes be recorded.
+   */
+  void set_tracing(bool const is_tracing);
+
+  /*!
+   * @returns Every recorded sample, sorted by time.
+   */
+  std::vector<Sample> const &trace(void) const;
+
+  /*!
+   * @param id Index of the machine.
+   *
+   * @returns Only the samples of that machine, sorted by time.
+   */
+  std::vector<Sample> trace(unsigned short const id) const;
+
+private:
+  unsigned long _now;
+  unsigned long _ticks = 0;
+  bool _is_tracing = true;
+
+  std::vector<PServo *> _machines;
+  std::vector<unsigned long> _deadline; // `NEVER` for the finished ones.
+  std::vector<Sample> _trace;
+
+  void _record(unsigned short const id);
+};
+}; // namespace sim
+}; // namespace ps
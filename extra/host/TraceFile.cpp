@@ -0,0 +1,100 @@
+#include "TraceFile.h"
+
+#include <algorithm>
+#include <cstdio>
+
+std::vector<ps::trace::Record>
+ps::trace::decode(std::vector<unsigned char> const &bytes) {
+  using namespace ps;
+
+  std::vector<trace::Record> records;
+
+  if (bytes.size() < trace::HEADER_SIZE or bytes[0] != trace::MAGIC_0 or
+      bytes[1] != trace::MAGIC_1 or bytes[2] != trace::VERSION)
+    return records;
+
+  records.reserve((bytes.size() - trace::HEADER_SIZE) / trace::RECORD_SIZE);
+
+  for (unsigned long at = trace::HEADER_SIZE;
+       at + trace::RECORD_SIZE <= bytes.size(); at += trace::RECORD_SIZE) {
+    unsigned char const *const b = bytes.data() + at;
+
+    records.push_back(trace::Record{
+        (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 |
+            (uint32_t)b[3] << 24,
+        b[4],
+        b[5],
+        (State)b[6],
+        b[7],
+    });
+  }
+
+  return records;
+}
+
+bool ps::trace::load(char const *const path,
+                     std::vector<ps::trace::Record> *const records) {
+  std::FILE *const file = std::fopen(path, "rb");
+
+  if (file == nullptr)
+    return false;
+
+  std::vector<unsigned char> bytes;
+  unsigned char chunk[4096];
+
+  for (unsigned long n; (n = std::fread(chunk, 1, sizeof(chunk), file)) > 0;)
+    bytes.insert(bytes.end(), chunk, chunk + n);
+
+  bool const is_read = std::ferror(file) == 0;
+
+  std::fclose(file);
+  *records = decode(bytes);
+
+  return is_read;
+}
+
+std::string ps::trace::csv(std::vector<ps::trace::Record> const &records) {
+  std::string text = "time,id,pos,state,action\n";
+  char line[64];
+
+  for (trace::Record const &r : records) {
+    std::snprintf(line, sizeof(line), "%lu,%u,%u,%s,%u\n",
+                  (unsigned long)r.time, r.id, r.pos, state_text(r.state),
+                  r.action);
+    text += line;
+  }
+
+  return text;
+}
+
+std::string ps::trace::timeline(std::vector<ps::trace::Record> const &records) {
+  std::vector<trace::Record> sorted = records;
+
+  // Stable, so the samples of the same time keep the order they were recorded.
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](trace::Record const &a, trace::Record const &b) {
+                     return a.id < b.id;
+                   });
+
+  std::string text;
+  char line[96];
+
+  for (unsigned long i = 0; i < sorted.size();) {
+    trace::Record const &first = sorted[i];
+    unsigned long last = i;
+
+    while (last + 1 < sorted.size() and sorted[last + 1].id == first.id and
+           sorted[last + 1].state == first.state and
+           sorted[last + 1].action == first.action)
+      ++last;
+
+    std::snprintf(line, sizeof(line), "#%u %lu..%lu %s action %u, %u -> %u\n",
+                  first.id, (unsigned long)first.time,
+                  (unsigned long)sorted[last].time, state_text(first.state),
+                  first.action, first.pos, sorted[last].pos);
+    text += line;
+    i = last + 1;
+  }
+
+  return text;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+/*!
+ * Host only tools for the binary trace format (see `ps::trace`), used to read
+ * the dumps that a `ps::Trace` sends from the board -- as CSV, to be plotted
+ * or loaded in a spreadsheet, or as a timeline of what each machine did.
+ */
+
+#include <string>
+#include <vector>
+
+#include "../../src/Trace.h"
+
+namespace ps {
+namespace trace {
+/*!
+ * @param bytes The whole dump, header included.
+ *
+ * @returns Every complete record of the dump, or none if the header is not
+ * valid. A record cut at the end of the dump is ignored.
+ */
+std::vector<Record> decode(std::vector<unsigned char> const &bytes);
+
+/*!
+ * Reads and decodes a dump file.
+ *
+ * @param path File to be read.
+ * @param records Where the records should be written to.
+ *
+ * @returns `false` if the file could not be read.
+ */
+bool load(char const *const path, std::vector<Record> *const records);
+
+/*!
+ * @param records Decoded records.
+ *
+ * @returns One line per record, after a `time,id,pos,state,action` header.
+ */
+std::string csv(std::vector<Record> const &records);
+
+/*!
+ * Groups the records of each machine into spans, a new one starts every time
+ * the state or the active action changes.
+ *
+ * @param records Decoded records.
+ *
+ * @returns One line per span, ordered by machine and then by time, like
+ * `#0 100..350 IN_ACTION action 1, 90 -> 180`.
+ */
+std::string timeline(std::vector<Record> const &records);
+}; // namespace trace
+}; // namespace ps
@@ -0,0 +1,35 @@
+// Decodes a dump of a `ps::Trace`, like the bytes saved from the serial port,
+// and prints it as CSV or as a timeline of each machine.
+//
+// Usage: trace [--timeline] <dump>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "../host/TraceFile.h"
+
+int main(int const argc, char const *const *const argv) {
+  using namespace ps;
+
+  bool const is_timeline =
+      argc == 3 and std::strcmp(argv[1], "--timeline") == 0;
+
+  if (argc != 2 and not is_timeline) {
+    std::fprintf(stderr, "Usage: %s [--timeline] <dump>\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<trace::Record> records;
+
+  if (not trace::load(argv[argc - 1], &records)) {
+    std::fprintf(stderr, "Could not read %s\n", argv[argc - 1]);
+    return 1;
+  }
+
+  std::fputs(is_timeline ? trace::timeline(records).c_str()
+                         : trace::csv(records).c_str(),
+             stdout);
+
+  return 0;
+}
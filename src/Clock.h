@@ -0,0 +1,90 @@
+#pragma once
+
+#if defined(__AVR__)
+#include <util/atomic.h>
+#endif
+
+namespace ps {
+/*!
+ * Where a machine reads the time from, instead of a timer variable that the
+ * sketch should update on every `loop()` iteration. Since the clock is read
+ * when it's needed, the timing doesn't depend on how fast the loop runs.
+ *
+ * Any time unit works, as long as the delays of the actions use the same one,
+ * like microseconds with the `ps::FunctionClock<micros>` clock.
+ *
+ * @see ps::FunctionClock
+ * @see ps::AtomicClock
+ */
+class Clock {
+public:
+  virtual ~Clock() = default;
+
+  /*!
+   * @returns The current time.
+   */
+  virtual unsigned long now(void) const = 0;
+};
+
+/*!
+ * Clock that calls a function to get the time, bound at compile time, like
+ * the Arduino `millis()` or `micros()` functions.
+ *
+ * For an example:
+ * ```cpp
+ * ps::FunctionClock<millis> clock;
+ *
+ * ps::PServo myservo_machine(clock);
+ *
+ * void loop() {
+ *   myservo.write(myservo_machine.pos());
+ *
+ *   myservo_machine.begin()
+ *       ->move(180, 10)
+ *       ->move(0, 10);
+ * }
+ * ```
+ */
+template <unsigned long (*Now)(void)> class FunctionClock : public Clock {
+public:
+  unsigned long now(void) const override { return Now(); }
+};
+
+/*!
+ * Clock that reads a counter updated by an interrupt routine, like a timer
+ * overflow one. On AVR boards the interrupts are disabled while the 4 bytes
+ * are copied, so the value never comes half updated.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned long volatile ticks = 0;
+ *
+ * ISR(TIMER2_COMPA_vect) { ++ticks; }
+ *
+ * ps::AtomicClock clock(ticks);
+ * ps::PServo myservo_machine(clock);
+ * ```
+ */
+class AtomicClock : public Clock {
+public:
+  /*!
+   * @param counter The counter updated by the interrupt routine.
+   */
+  AtomicClock(unsigned long volatile &counter) : _counter(counter) {}
+
+  unsigned long now(void) const override {
+#if defined(__AVR__)
+    unsigned long value;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { value = _counter; }
+
+    return value;
+#else
+    return __atomic_load_n(&_counter, __ATOMIC_ACQUIRE);
+#endif
+  }
+
+private:
+  unsigned long volatile &_counter;
+};
+}; // namespace ps
@@ -0,0 +1,97 @@
+#include "CompactServo.h"
+
+ps::CompactServo::CompactServo(bool const is_resetable)
+    : _state((unsigned char)State::STANDBY), _is_resetable(is_resetable),
+      _is_timed(false) {}
+
+ps::CompactServo *ps::CompactServo::load(ps::Action const *const actions,
+                                         unsigned char const actions_count) {
+  using namespace ps;
+
+  _actions = actions;
+  _actions_count = actions == nullptr ? 0 : actions_count;
+  _active_action = 0;
+  _is_timed = false;
+  _state = (unsigned char)(_actions_count < 1 ? State::ERROR_NOACTION
+                                              : State::IN_ACTION);
+
+  return this;
+}
+
+ps::CompactServo *ps::CompactServo::tick(ps::Rig const &rig) {
+  using namespace ps;
+
+  if ((State)_state != State::IN_ACTION)
+    return this;
+
+  if (rig.timer == nullptr) {
+    _state = (unsigned char)State::ERROR_TIMERPTR;
+    return this;
+  }
+
+  unsigned short const now = *rig.timer; // Only the lowest 16 bits.
+
+  for (;;) { // Keep going if an action was completed, just like `PServo`.
+    unsigned char const action = _active_action;
+
+    if (_pos != _actions[action].pos) {
+      _step(rig, now);
+      break;
+    }
+
+    _advance();
+
+    if ((State)_state != State::IN_ACTION or _active_action <= action)
+      break;
+  }
+
+  return this;
+}
+
+void ps::CompactServo::reset(void) {
+  using namespace ps;
+
+  if ((State)_state != State::HALT)
+    return;
+
+  _active_action = 0;
+  _state = (unsigned char)State::IN_ACTION;
+}
+
+unsigned char ps::CompactServo::pos(void) const { return _pos; }
+
+unsigned char ps::CompactServo::active_action(void) const {
+  return _active_action;
+}
+
+ps::State ps::CompactServo::get_state(void) const { return (State)_state; }
+
+bool ps::CompactServo::is_state(ps::State const s) const {
+  return (State)_state == s;
+}
+
+inline void ps::CompactServo::_step(ps::Rig const &rig,
+                                    unsigned short const now) {
+  Action const &action = _actions[_active_action];
+
+  // The first step of a scene doesn't wait, like a `PServo` that was idle.
+  if (_is_timed and (unsigned short)(now - _pc) < action.delay)
+    return;
+
+  _pc = now;
+  _is_timed = true;
+  _pos = _pos < action.pos ? _pos + 1 : _pos - 1;
+  _pos = _pos < rig.min ? rig.min : _pos > rig.max ? rig.max : _pos;
+}
+
+inline void ps::CompactServo::_advance(void) {
+  using namespace ps;
+
+  if (++_active_action < _actions_count)
+    return;
+
+  if (_is_resetable)
+    _active_action = 0;
+  else
+    _state = (unsigned char)State::HALT;
+}
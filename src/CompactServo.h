@@ -0,0 +1,133 @@
+#pragma once
+
+#include "PServo.h"
+
+namespace ps {
+/*!
+ * What every `ps::CompactServo` of a rig has in common, it's stored once and
+ * given to each `CompactServo::tick()` call, instead of being copied in every
+ * machine.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned long timer = 0;
+ *
+ * ps::Rig const rig = {&timer, 0, 180};
+ * ```
+ *
+ * @see ps::CompactServo
+ */
+typedef struct Rig {
+  unsigned long *const timer; //!< Pointer to the timer variable in use.
+  unsigned char const min;    //!< Minimal position of every machine.
+  unsigned char const max;    //!< Maximum position of every machine.
+} Rig;
+
+/*!
+ * Smaller version of the `ps::PServo` machine, for boards with little RAM and
+ * lots of servos. It runs compiled scenes (see `ps::PServo::load()`) in the
+ * same way, but the timer and the limits are shared by the whole rig (see
+ * `ps::Rig`), the state and the flags are packed into a single byte, and the
+ * process counter only keeps the lowest 16 bits of the timer -- so each
+ * machine takes 8 bytes on an AVR board, instead of about 22.
+ *
+ * The trade-offs are the same of the `ps::ServoBank`: only the
+ * `ps::Profile::STEP` actions are supported (the profile of each action is
+ * ignored), and the machine should be updated at least once every 65535 timer
+ * units, or the next step may come up to that late.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned long timer = 0;
+ *
+ * ps::Rig const rig = {&timer, 0, 180};
+ * ps::CompactServo machines[16];
+ *
+ * void setup() {
+ *   for (ps::CompactServo &machine : machines)
+ *     machine.load(wave, 2);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   for (unsigned char i = 0; i < 16; ++i) {
+ *     machines[i].tick(rig);
+ *     pwm.setPWM(i, 0, angle_to_pulse(machines[i].pos()));
+ *   }
+ * }
+ * ```
+ *
+ * @see ps::Rig
+ * @see ps::PServo
+ */
+class CompactServo {
+public:
+  /*!
+   * @param is_resetable Configure the machine to reset after it's halted.
+   */
+  CompactServo(bool const is_resetable = false);
+
+  /*!
+   * Registers a compiled scene, it works exactly like the `ps::PServo::load()`
+   * method. The table is **not** copied.
+   *
+   * @param actions Table with each action that this machine should perform.
+   * @param actions_count How much actions there are in the `actions` table.
+   *
+   * @returns A pointer to the machine.
+   */
+  CompactServo *load(Action const *const actions,
+                     unsigned char const actions_count);
+
+  /*!
+   * Same as `ps::PServo::tick()`, using the timer and the limits of the rig.
+   *
+   * @param rig What this machine shares with the others.
+   *
+   * @returns A pointer to the machine.
+   */
+  CompactServo *tick(Rig const &rig);
+
+  /*!
+   * Same as `ps::PServo::reset()`, but the machine is ready to start over on
+   * the next `tick()` right away, since the scene is already counted.
+   */
+  void reset(void);
+
+  /*!
+   * @returns The current registered postion.
+   */
+  unsigned char pos(void) const;
+
+  /*!
+   * @returns Which action it's performing.
+   */
+  unsigned char active_action(void) const;
+
+  /*!
+   * @returns The current state of the machine.
+   */
+  State get_state(void) const;
+
+  /*!
+   * @param s State to compare to.
+   *
+   * @returns Is the machine in the specified state?
+   */
+  bool is_state(State const s) const;
+
+private:
+  Action const *_actions = nullptr;
+  unsigned short _pc = 0; // Lowest 16 bits of the timer, on the last step.
+  unsigned char _pos = 0;
+  unsigned char _active_action = 0;
+  unsigned char _actions_count = 0;
+  unsigned char _state : 3; // A `ps::State` value.
+  unsigned char _is_resetable : 1;
+  unsigned char _is_timed : 1; // Does the `_pc` hold a real step time?
+
+  inline void _step(Rig const &rig, unsigned short const now);
+  inline void _advance(void);
+};
+}; // namespace ps
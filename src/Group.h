@@ -0,0 +1,115 @@
+#pragma once
+
+#include "PServo.h"
+
+namespace ps {
+/*!
+ * A set of machines that moves together, like the joints of an arm. Each
+ * `Group::move()` gives a target for every axis and a single duration, and all
+ * of them arrive at the same time, no matter how far each one has to go -- no
+ * need to tune the delay of each machine by hand.
+ *
+ * Each axis performs a `ps::Profile::LINEAR` sweep (or any other profile) with
+ * the same duration, started on the same update. The linear sweeps step each
+ * degree with the Bresenham line algorithm, so the speed of every axis comes
+ * from the integer ratio between its distance and the duration, without any
+ * division on each update.
+ *
+ * The machines should not be resetable, and should not be used with any other
+ * scene while the group is moving them.
+ *
+ * For an example:
+ * ```cpp
+ * ps::FunctionClock<millis> clock;
+ *
+ * ps::PServo shoulder(clock);
+ * ps::PServo elbow(clock);
+ *
+ * ps::PServo *const arm_machines[] = {&shoulder, &elbow};
+ * ps::Group<2> arm(arm_machines);
+ *
+ * void loop() {
+ *   if (not arm.is_moving()) {
+ *     unsigned char const reach[] = {120, 45};
+ *
+ *     arm.move(reach, 800); // Both arrive after 800 ms.
+ *   }
+ *
+ *   arm.tick();
+ *
+ *   shoulder_servo.write(shoulder.pos());
+ *   elbow_servo.write(elbow.pos());
+ * }
+ * ```
+ *
+ * @see ps::PServo::sweep()
+ */
+template <unsigned char N> class Group {
+public:
+  /*!
+   * @param machines The machines of each axis, in the same order as the
+   * targets given to `Group::move()`. The array is copied.
+   */
+  Group(PServo *const (&machines)[N]) {
+    for (unsigned char i = 0; i < N; ++i) {
+      _machines[i] = machines[i];
+      _actions[i] = Action{0, 0, Profile::LINEAR};
+    }
+  }
+
+  /*!
+   * Starts a coordinated move, from where each axis is right now. The actual
+   * movement starts on the next `Group::tick()` call.
+   *
+   * @param targets The next position of each axis.
+   * @param duration How long every axis takes to get there.
+   * @param profile Shape of the motion, the same one for every axis.
+   */
+  void move(unsigned char const (&targets)[N], unsigned short const duration,
+            Profile const profile = Profile::LINEAR) {
+    for (unsigned char i = 0; i < N; ++i) {
+      _actions[i] = Action{targets[i], duration, profile};
+      _machines[i]->load(&_actions[i], 1);
+    }
+  }
+
+  /*!
+   * Updates every axis, on the same loop iteration.
+   *
+   * Since this function is asynchronous, it **should be called every time in
+   * the `loop()` function**!
+   */
+  void tick(void) {
+    for (unsigned char i = 0; i < N; ++i)
+      _machines[i]->tick();
+  }
+
+  /*!
+   * @returns Is any axis still moving (or waiting to notice that it's done)?
+   */
+  bool is_moving(void) const {
+    for (unsigned char i = 0; i < N; ++i) {
+      if (_machines[i]->is_state(State::IN_ACTION))
+        return true;
+    }
+
+    return false;
+  }
+
+  /*!
+   * @param i Index of the axis.
+   *
+   * @returns The machine of that axis.
+   */
+  PServo &operator[](unsigned char const i) { return *_machines[i]; }
+
+  /*!
+   * @returns How much axes this group has.
+   */
+  unsigned char size(void) const { return N; }
+
+private:
+  PServo *_machines[N];
+  Action _actions[N]; // The scene of each axis, a single action.
+};
+}; // namespace ps
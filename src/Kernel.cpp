@@ -0,0 +1,129 @@
+#include "Kernel.h"
+#include "PServo.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+inline unsigned char step_one(unsigned char const pos,
+                              unsigned char const target,
+                              unsigned char const min,
+                              unsigned char const max) {
+  unsigned char next = pos < target ? pos + 1 : pos - 1;
+
+  return next < min ? min : next > max ? max : next;
+}
+
+void step_scalar(unsigned char *const pos, unsigned char const *const target,
+                 unsigned char const *const min,
+                 unsigned char const *const max, unsigned char *const go,
+                 unsigned short const begin, unsigned short const count) {
+  for (unsigned short i = begin; i < count; ++i) {
+    go[i] = pos[i] == target[i] ? 0x00 : go[i];
+    pos[i] = go[i] ? step_one(pos[i], target[i], min[i], max[i]) : pos[i];
+  }
+}
+
+// Same operations for both vector widths, so the kernel is written once.
+#if defined(__AVX2__)
+typedef __m256i Vec;
+unsigned char constexpr WIDTH = 32;
+
+inline Vec load(unsigned char const *p) {
+  return _mm256_loadu_si256((Vec const *)p);
+}
+inline void store(unsigned char *p, Vec v) { _mm256_storeu_si256((Vec *)p, v); }
+inline Vec splat(unsigned char b) { return _mm256_set1_epi8((char)b); }
+inline Vec eq(Vec a, Vec b) { return _mm256_cmpeq_epi8(a, b); }
+inline Vec umax(Vec a, Vec b) { return _mm256_max_epu8(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm256_sub_epi8(a, b); }
+inline Vec vand(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+inline Vec vandnot(Vec a, Vec b) { return _mm256_andnot_si256(a, b); }
+inline Vec vor(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+inline Vec blend(Vec m, Vec a, Vec b) { return _mm256_blendv_epi8(b, a, m); }
+#elif defined(__SSE2__)
+typedef __m128i Vec;
+unsigned char constexpr WIDTH = 16;
+
+inline Vec load(unsigned char const *p) {
+  return _mm_loadu_si128((Vec const *)p);
+}
+inline void store(unsigned char *p, Vec v) { _mm_storeu_si128((Vec *)p, v); }
+inline Vec splat(unsigned char b) { return _mm_set1_epi8((char)b); }
+inline Vec eq(Vec a, Vec b) { return _mm_cmpeq_epi8(a, b); }
+inline Vec umax(Vec a, Vec b) { return _mm_max_epu8(a, b); }
+inline Vec sub(Vec a, Vec b) { return _mm_sub_epi8(a, b); }
+inline Vec vand(Vec a, Vec b) { return _mm_and_si128(a, b); }
+inline Vec vandnot(Vec a, Vec b) { return _mm_andnot_si128(a, b); }
+inline Vec vor(Vec a, Vec b) { return _mm_or_si128(a, b); }
+inline Vec blend(Vec m, Vec a, Vec b) { return vor(vand(m, a), vandnot(m, b)); }
+#else
+unsigned char constexpr WIDTH = 1;
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+// Unsigned `a >= b`, there is no such compare. It's used as is, with the blend
+// arms swapped, instead of negated into an `a < b` mask.
+inline Vec at_least(Vec a, Vec b) { return eq(umax(a, b), a); }
+#endif
+}; // namespace
+
+void ps::kernel::step(unsigned char *const pos,
+                      unsigned char const *const target,
+                      unsigned char const *const min,
+                      unsigned char const *const max, unsigned char *const go,
+                      unsigned short const count) {
+  unsigned short i = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+  Vec const ones = splat(0x01);
+  Vec const all = splat(0xFF);
+
+  for (; i + WIDTH <= count; i += WIDTH) {
+    Vec const p = load(pos + i);
+    Vec const t = load(target + i);
+    Vec const lo = load(min + i);
+    Vec const hi = load(max + i);
+
+    // Going up subtracts 0xFF (wraps to +1), going down subtracts 0x01.
+    Vec const next = sub(p, blend(at_least(p, t), ones, all));
+    Vec const clamped =
+        blend(at_least(next, lo), blend(at_least(hi, next), next, hi), lo);
+    Vec const mask = vandnot(eq(p, t), load(go + i));
+
+    store(go + i, mask);
+    store(pos + i, blend(mask, clamped, p));
+  }
+#endif
+
+  step_scalar(pos, target, min, max, go, i, count);
+}
+
+void ps::kernel::advance(ps::kernel::Batch const &b, unsigned long const now) {
+  for (unsigned short i = 0; i < b.count; ++i)
+    b.go[i] = ps::elapsed(b.pc[i], now) >= b.delay[i] ? 0xFF : 0x00;
+
+  step(b.pos, b.target, b.min, b.max, b.go, b.count);
+
+  for (unsigned short i = 0; i < b.count; ++i)
+    b.pc[i] = b.go[i] ? now : b.pc[i];
+}
+
+void ps::kernel::advance_scalar(ps::kernel::Batch const &b,
+                                unsigned long const now) {
+  for (unsigned short i = 0; i < b.count; ++i) {
+    bool const is_due =
+        b.pos[i] != b.target[i] and ps::elapsed(b.pc[i], now) >= b.delay[i];
+
+    b.go[i] = is_due ? 0xFF : 0x00;
+
+    if (not is_due)
+      continue;
+
+    b.pc[i] = now;
+    b.pos[i] = step_one(b.pos[i], b.target[i], b.min[i], b.max[i]);
+  }
+}
+
+unsigned char ps::kernel::width(void) { return WIDTH; }
@@ -0,0 +1,76 @@
+#pragma once
+
+/*!
+ * Bulk position stepping, used to update many state machines at once. This is
+ * the same math of the `ps::PServo::move()` method -- one degree towards the
+ * target, clamped between the min and max limits, only when the delay has
+ * passed -- but over plain arrays, one servo per byte.
+ *
+ * On the host it's vectorized with AVX2 (32 servos per instruction) or SSE2
+ * (16 servos per instruction), depending on what the compiler was allowed to
+ * use. On any other target, like the AVR boards, it falls back to the scalar
+ * version. All of them give bit-identical results, the test suite checks the
+ * vector paths against the scalar one (`make test` for SSE2, `make test/native`
+ * with the same flags of the benchmarks).
+ *
+ * @see ps::ServoBank
+ */
+namespace ps {
+namespace kernel {
+/*!
+ * Set of arrays, all of them with `count` elements, that describes a batch of
+ * servos to be updated by `ps::kernel::advance()`.
+ */
+typedef struct Batch {
+  unsigned char *pos;          //!< Current positions, will be updated.
+  unsigned char const *target; //!< Target position of the active actions.
+  unsigned char const *min;    //!< Minimal position of each servo.
+  unsigned char const *max;    //!< Maximum position of each servo.
+  unsigned long *pc;           //!< Last registered process counters.
+  unsigned short const *delay; //!< Delay of the active actions.
+  unsigned char *go;           //!< Scratch mask, `0xFF` where it has stepped.
+  unsigned short count;        //!< Number of servos in the batch.
+} Batch;
+
+/*!
+ * Moves every servo of the batch that is due (`now - pc >= delay`) and not at
+ * its target yet by one degree, then updates its `pc` to `now`. The `go` array
+ * will tell which servos has stepped.
+ *
+ * @param b Batch of servos to update.
+ * @param now Current value of the timer.
+ */
+void advance(Batch const &b, unsigned long const now);
+
+/*!
+ * Same as `ps::kernel::advance()`, but without any vector instruction. It's the
+ * reference implementation that the vectorized one is tested against.
+ *
+ * @param b Batch of servos to update.
+ * @param now Current value of the timer.
+ */
+void advance_scalar(Batch const &b, unsigned long const now);
+
+/*!
+ * The byte-wide part of `ps::kernel::advance()`. For each servo where the `go`
+ * mask is `0xFF`, step it one degree towards its target and clamp it. The mask
+ * is cleared for the servos that are already at their target.
+ *
+ * @param pos Current positions, will be updated.
+ * @param target Target positions.
+ * @param min Minimal position of each servo.
+ * @param max Maximum position of each servo.
+ * @param go Mask of servos that should step, `0xFF` for yes and `0x00` for no.
+ * @param count Number of servos on each array.
+ */
+void step(unsigned char *const pos, unsigned char const *const target,
+          unsigned char const *const min, unsigned char const *const max,
+          unsigned char *const go, unsigned short const count);
+
+/*!
+ * @returns How much servos are updated by a single vector instruction, `1`
+ * when there is no vector support.
+ */
+unsigned char width(void);
+}; // namespace kernel
+}; // namespace ps
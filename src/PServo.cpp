@@ -1,8 +1,38 @@
 #include "PServo.h"
 
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define PS_READ_TABLE(entry) pgm_read_byte(&(entry))
+#else
+#define PROGMEM
+#define PS_READ_TABLE(entry) (entry)
+#endif
+
+namespace {
+// Fixed-point curves of each profile, sampled on 33 points, from the start
+// (0) to the end (255) of the movement. Kept in flash on AVR boards.
+unsigned char const TRAPEZOID_TABLE[] PROGMEM = {
+    0,   1,   2,   5,   9,   14,  20,  28,  36,  46,  56,
+    68,  80,  92,  104, 116, 128, 140, 152, 164, 176, 188,
+    200, 210, 220, 228, 236, 242, 247, 251, 254, 255, 255,
+};
+
+unsigned char const SCURVE_TABLE[] PROGMEM = {
+    0,   0,   1,   2,   4,   8,   12,  19,  26,  36,  46,
+    58,  70,  84,  98,  113, 128, 143, 158, 172, 186, 198,
+    210, 220, 230, 237, 244, 248, 252, 254, 255, 255, 255,
+};
+}; // namespace
+
 ps::PServo *ps::PServo::begin(void) {
   using namespace ps;
 
+  unsigned long const now = _now();
+
+#if defined(PS_INSTRUMENT)
+  _observe(now);
+#endif
+
   _curr_action = 0;
 
   switch (_state) {
@@ -16,16 +46,16 @@ ps::PServo *ps::PServo::begin(void) {
       break;
     }
 
-    _reset_active_action_to_start_again();
+    _start_scene(now);
     break;
 
   case State::PAUSED: // To keep pause, don't do anything, just update _pc.
-    if (_timer == nullptr) {
+    if (not _has_time()) {
       _state = State::ERROR_TIMERPTR;
       break;
     }
 
-    _pc = *_timer;
+    _pc = now;
     break;
 
   case State::IN_ACTION:
@@ -40,17 +70,51 @@ ps::PServo *ps::PServo::begin(void) {
   return this;
 }
 
+ps::PServo *ps::PServo::begin(unsigned char const actions_count) {
+  using namespace ps;
+
+  if (_state != State::STANDBY and _state != State::INITIALIZED)
+    return begin();
+
+  unsigned long const now = _now();
+
+#if defined(PS_INSTRUMENT)
+  _observe(now);
+#endif
+
+  _curr_action = 0;
+  _actions_count = actions_count; // Already known, so skip the counting.
+
+  _start_scene(now);
+
+  return this;
+}
+
 ps::PServo *ps::PServo::move(unsigned char const next_pos,
                              unsigned short const delay) {
   using namespace ps;
 
+  return _chain(Action{next_pos, delay, Profile::STEP});
+}
+
+ps::PServo *ps::PServo::sweep(unsigned char const next_pos,
+                              unsigned short const duration,
+                              ps::Profile const profile) {
+  using namespace ps;
+
+  return _chain(Action{next_pos, duration, profile});
+}
+
+inline ps::PServo *ps::PServo::_chain(ps::Action const &action) {
+  using namespace ps;
+
   switch (_state) {
   case State::INITIALIZED: // Count actions ammount before the first halt.
     ++_actions_count;
     break;
 
   case State::IN_ACTION: // Start the async timer for the current action.
-    if (_timer == nullptr) {
+    if (not _has_time()) {
       _state = State::ERROR_TIMERPTR;
       break;
     }
@@ -58,37 +122,495 @@ ps::PServo *ps::PServo::move(unsigned char const next_pos,
     if (_active_action != _curr_action)
       break;
 
-    if (_pos == next_pos) {
-      _reset_or_update_and_start_next_action();
+    _perform(action, _now());
+    break;
+
+  case State::PAUSED:
+  case State::HALT:
+  case State::ERROR_NOACTION:
+    break;
+
+  default:
+    _state = State::ERROR_UNEXPECTED;
+  }
+
+  ++_curr_action;
+
+  return this;
+}
+
+ps::PServo *ps::PServo::load(ps::Action const *const actions,
+                             unsigned char const actions_count) {
+  using namespace ps;
+
+  _actions.table = actions;
+  _actions_count = actions == nullptr ? 0 : actions_count;
+  _is_streamed = false;
+  _is_progmem = false;
+  _curr_action = 0;
+
+  _start_scene(_now());
+
+  return this;
+}
+
+ps::PServo *ps::PServo::load_progmem(ps::Action const *const actions,
+                                     unsigned char const actions_count) {
+  load(actions, actions_count); // The table isn't read when it starts.
+
+  _is_progmem = true;
+
+  return this;
+}
+
+ps::PServo *ps::PServo::play(ps::ActionSource *const source) {
+  using namespace ps;
+
+  _is_streamed = source != nullptr;
+  _actions_count = 0;
+  _curr_action = 0;
+
+  if (_is_streamed)
+    _actions.source = source;
+  else
+    _actions.table = nullptr; // Nothing to play at all.
+
+
+  _start_scene(_now());
+
+  return this;
+}
+
+ps::PServo *ps::PServo::tick(void) {
+  unsigned long const now = _now(); // Read once, for the whole update.
+
+#if defined(PS_INSTRUMENT)
+  _observe(now);
+#endif
+
+  return _update(now);
+}
+
+inline ps::PServo *ps::PServo::_update(unsigned long const now) {
+  using namespace ps;
+
+  if (not has_scene()) {
+    _state = State::ERROR_NOACTION;
+    return this;
+  }
+
+  switch (_state) {
+  case State::STANDBY: // The table is already counted, so start it right away.
+  case State::INITIALIZED:
+    _start_scene(now);
+    return _update(now);
+
+  case State::IN_ACTION: // Jump to the active action, no need to walk them.
+    if (not _has_time()) {
+      _state = State::ERROR_TIMERPTR;
       break;
     }
 
-    _delay = delay < Default::DELAY ? Default::DELAY : delay;
+    for (;;) { // Keep going if an action was completed, just like the chain.
+      unsigned char const action = _active_action;
+
+      _curr_action = action;
+      _perform(_active(), now);
 
-    if (*_timer - _pc >= delay) {
-      _pc = *_timer;
-      _pos = _pos < next_pos ? _pos + 1 : _pos - 1;
-      _pos = _pos < _min ? _min : _pos > _max ? _max : _pos;
+      if (_state != State::IN_ACTION or _active_action <= action)
+        break;
     }
 
     break;
 
   case State::PAUSED:
-  case State::HALT:
+    if (not _has_time()) {
+      _state = State::ERROR_TIMERPTR;
+      break;
+    }
+
+    _pc = now;
+    break;
+
+  case State::HALT: // A stream may get new actions after it ran out of them.
   case State::ERROR_NOACTION:
+    if (_is_streamed) {
+      State const idle = _state;
+
+      _start_scene(now);
+
+      if (_state == State::IN_ACTION)
+        return _update(now);
+
+      _state = idle;
+    }
+
     break;
 
   default:
     _state = State::ERROR_UNEXPECTED;
   }
 
-  ++_curr_action;
-
   return this;
 }
 
+#if defined(PS_INSTRUMENT)
+inline void ps::PServo::_observe(unsigned long const now) {
+  using namespace ps;
+
+  if (_has_time()) { // The time since the last update was spent in this state.
+    if (_stats.ticks > 0)
+      _stats.in_state[(unsigned char)_state] += elapsed(_stats.last, now);
+
+    _stats.last = now;
+  }
+
+  ++_stats.ticks;
+}
+#endif
+
+inline bool ps::PServo::_has_time(void) const {
+  return _is_clocked or _time.timer != nullptr; // A clock is never null.
+}
+
+inline unsigned long ps::PServo::_now(void) const {
+  if (_is_clocked)
+    return _time.clock->now();
+
+  return _time.timer != nullptr ? *_time.timer : 0;
+}
+
+inline unsigned char ps::PServo::_min(void) const {
+  return _is_shared ? _limits.shared->min : _limits.own[0];
+}
+
+inline unsigned char ps::PServo::_max(void) const {
+  return _is_shared ? _limits.shared->max : _limits.own[1];
+}
+
+inline unsigned char ps::PServo::_clamp(unsigned char const pos) const {
+  unsigned char const min = _min();
+  unsigned char const max = _max();
+
+  return pos < min ? min : pos > max ? max : pos;
+}
+
+inline ps::Action ps::PServo::_active(void) const {
+  return _is_streamed ? _actions.source->_current : _action_at(_active_action);
+}
+
+inline ps::Action ps::PServo::_action_at(unsigned char const i) const {
+#if defined(__AVR__)
+  if (_is_progmem) { // Only this one is copied to RAM.
+    Action action;
+
+    memcpy_P(&action, _actions.table + i, sizeof(Action));
+
+    return action;
+  }
+#endif
+
+  return _actions.table[i];
+}
+
+inline bool ps::PServo::_pull(void) {
+  ActionSource *const source = _actions.source;
+
+  return source->next(&source->_current);
+}
+
+inline void ps::PServo::_perform(ps::Action const &action,
+                                 unsigned long const now) {
+  using namespace ps;
+
+  unsigned char const pos = _pos;
+  unsigned char const frac = _frac;
+
+  if (action.profile == Profile::STEP)
+    _step(action.pos, action.delay, now);
+  else
+    _sweep(action.pos, action.delay, action.profile, now);
+
+  _is_changed = _is_changed or _pos != pos or _frac != frac;
+
+#if defined(PS_INSTRUMENT)
+  _stats.steps += _pos != pos ? 1 : 0;
+#endif
+}
+
+inline void ps::PServo::_step(unsigned char const next_pos,
+                              unsigned short const delay,
+                              unsigned long const now) {
+  _is_blending_out = false; // Only sweeps can blend.
+
+  if (_is_fresh and not _is_high_res) { // The glide has its own start.
+    _is_fresh = false;
+    _origin = _pos;
+  }
+
+  if ((_pos == next_pos and _frac == 0) or _cuts_corner(next_pos)) {
+    _reset_or_update_and_start_next_action();
+    return;
+  }
+
+  _delay = delay < Default::DELAY ? Default::DELAY : delay;
+
+  if (_is_high_res) {
+    _glide(next_pos, _delay, now);
+    return;
+  }
+
+  if (elapsed(_pc, now) < delay)
+    return;
+
+#if defined(PS_INSTRUMENT)
+  unsigned long const lateness = elapsed(_pc, now) - delay;
+
+  if (_is_timed) { // The first step of a scene has no deadline.
+    _stats.missed += lateness >= delay ? 1 : 0;
+    _stats.max_lateness =
+        lateness > _stats.max_lateness ? lateness : _stats.max_lateness;
+  }
+
+  _is_timed = true;
+#endif
+
+  if (not _is_catching_up or delay < Default::DELAY) {
+    _pc = now;
+    _pos = _pos < next_pos ? _pos + 1 : _pos - 1;
+    _pos = _clamp(_pos);
+    return;
+  }
+
+  // Move as many degrees as delays that have passed, but keep the leftover.
+  unsigned long const steps = elapsed(_pc, now) / delay;
+  unsigned char const distance =
+      _pos < next_pos ? next_pos - _pos : _pos - next_pos;
+  unsigned char const moved = steps < distance ? steps : distance;
+
+  _pc += (unsigned long)moved * delay; // Too big for 16 bits on AVR.
+  _pos = _pos < next_pos ? _pos + moved : _pos - moved;
+  _pos = _clamp(_pos);
+}
+
+inline void ps::PServo::_glide(unsigned char const next_pos,
+                               unsigned short const delay,
+                               unsigned long const now) {
+  unsigned char const target = _clamp(next_pos);
+
+  // Starts from where the servo is, and from when the last action has ended,
+  // unless that was too long ago.
+  if (_is_fresh) {
+    _is_fresh = false;
+    _origin = _pos;
+    _frac = 0;
+    _pc = elapsed(_pc, now) > delay ? now : _pc;
+  }
+
+  unsigned char const distance =
+      _origin < target ? target - _origin : _origin - target;
+  unsigned long const duration = (unsigned long)distance * delay;
+  unsigned long const passed = elapsed(_pc, now);
+
+  if (passed >= duration) { // The next action starts from when this one ended.
+    _pc += duration;
+    _place(target << 8);
+    return;
+  }
+
+  // Fits in 16 bits, since `passed` is less than `distance * delay`.
+  unsigned short const offset = (passed << 8) / delay;
+  unsigned short const origin = _origin << 8;
+
+  _place(_origin < target ? origin + offset : origin - offset);
+}
+
+inline void ps::PServo::_place(unsigned short const pos) {
+  unsigned short const min = _min() << 8;
+  unsigned short const max = _max() << 8;
+  unsigned short const clamped = pos < min ? min : pos > max ? max : pos;
+
+  _pos = clamped >> 8;
+  _frac = clamped & 0xFF;
+}
+
+inline void ps::PServo::_sweep(unsigned char const next_pos,
+                               unsigned short const duration,
+                               ps::Profile const profile,
+                               unsigned long const now) {
+  unsigned char const target = _clamp(next_pos);
+
+  if (_is_fresh) { // The movement starts now, from where the servo is.
+    _is_fresh = false;
+    _origin = _pos;
+    _pc = now;
+    _phase = 0;
+
+    _is_blending_in = _is_blending_out;
+    _is_blending_out = _blends_into(target);
+  }
+
+  _delay = duration;
+
+  unsigned long const passed = elapsed(_pc, now);
+
+  if (passed >= duration) {
+    if (_pos != target or _frac != 0) { // Notice it's done on the next update.
+      _pos = target;
+      _frac = 0;
+      return;
+    }
+
+    _pc += duration; // The next action starts from when this one ended.
+    _reset_or_update_and_start_next_action();
+    return;
+  }
+
+  if (_cuts_corner(target)) { // Close enough, the next one starts right now.
+    _pc = now;
+    _reset_or_update_and_start_next_action();
+    return;
+  }
+
+  if (profile == Profile::LINEAR and not _is_high_res) {
+    _linear(target, duration, passed);
+    return;
+  }
+
+  // The phase only goes forward, so it's stepped up to `passed / duration`,
+  // in 1/256 steps, with multiplications only -- instead of a division on
+  // each update, which is done in software on AVR boards.
+  while (_phase < 255 and (_phase + 1ul) * duration <= passed << 8)
+    ++_phase;
+
+  unsigned char const span =
+      _origin < target ? target - _origin : _origin - target;
+  unsigned short const offset = (unsigned short)span * _curve(profile, _phase);
+  unsigned short const origin = _origin << 8;
+
+  _place(_origin < target ? origin + offset : origin - offset);
+
+  if (not _is_high_res)
+    _frac = 0;
+}
+
+inline void ps::PServo::_linear(unsigned char const target,
+                                unsigned short const duration,
+                                unsigned long const passed) {
+  unsigned char const span =
+      _origin < target ? target - _origin : _origin - target;
+  unsigned char moved = _origin < _pos ? _pos - _origin : _origin - _pos;
+
+  // The k-th degree is due when `passed * span >= k * duration`, and k is how
+  // far the servo already is from the origin. So an update is a comparison
+  // and a multiplication, without any division nor state kept between them.
+  while (_pos != target and (moved + 1ul) * duration <= passed * span) {
+    _pos = _pos < target ? _pos + 1 : _pos - 1;
+    ++moved;
+  }
+
+  _pos = _clamp(_pos);
+  _frac = 0;
+}
+
+inline unsigned char ps::PServo::_curve(ps::Profile const profile,
+                                        unsigned char const phase) const {
+  if (_is_blending_in and _is_blending_out) // Full speed all the way.
+    return phase;
+
+  if (_is_blending_out) { // Only the first half of the curve, accelerating.
+    unsigned short const eased = ease(profile, phase >> 1) << 1;
+    return eased > 255 ? 255 : eased;
+  }
+
+  if (_is_blending_in) { // Only the second half, decelerating.
+    unsigned short const eased = ease(profile, 128 + (phase >> 1)) << 1;
+    return eased < 256 ? 0 : eased - 256;
+  }
+
+  return ease(profile, phase);
+}
+
+inline bool ps::PServo::_upcoming(ps::Action *const action) const {
+  if (_is_streamed)
+    return _actions.source->peek(action);
+
+  if (_actions.table == nullptr) // A `move()` chain can't tell.
+    return false;
+
+  if (_active_action + 1 < _actions_count)
+    *action = _action_at(_active_action + 1);
+  else if (_is_resetable)
+    *action = _action_at(0);
+  else
+    return false;
+
+  return true;
+}
+
+inline bool ps::PServo::_blends_into(unsigned char const target) const {
+  using namespace ps;
+
+  Action next;
+
+  if (not _is_looking_ahead or _origin == target or not _upcoming(&next) or
+      next.profile == Profile::STEP)
+    return false;
+
+  unsigned char const after = _clamp(next.pos);
+
+  return _origin < target ? after > target : after < target;
+}
+
+inline bool ps::PServo::_cuts_corner(unsigned char const target) const {
+  if (not _is_looking_ahead or _tolerance == 0 or _is_fresh or
+      _is_blending_out)
+    return false;
+
+  unsigned char const left = _pos < target ? target - _pos : _pos - target;
+  unsigned char const span =
+      _origin < target ? target - _origin : _origin - target;
+  Action next;
+
+  return left <= _tolerance and span > _tolerance and _upcoming(&next);
+}
+
+inline void ps::PServo::_start_scene(unsigned long const now) {
+  _is_blending_in = false;
+  _is_blending_out = false;
+
+#if defined(PS_INSTRUMENT)
+  _is_timed = false;
+#endif
+
+  if (_is_catching_up and _has_time())
+    _pc = now;
+
+  if (_is_streamed) // Only the first action is needed to start.
+    _actions_count = _pull() ? 1 : 0;
+
+  _reset_active_action_to_start_again();
+}
+
 inline void ps::PServo::_reset_or_update_and_start_next_action(void) {
   ++_active_action;
+  _is_fresh = true;
+
+  if (_is_streamed) { // Streamed scenes are never counted.
+    if (_pull()) {
+      _state = State::IN_ACTION;
+      return;
+    }
+
+    if (_is_resetable and _actions.source->rewind() and _pull()) {
+      _active_action = 0;
+      _state = State::IN_ACTION;
+      return;
+    }
+
+    _state = State::HALT;
+    return;
+  }
 
   if (_active_action >= _actions_count) {
     if (_is_resetable)
@@ -111,12 +633,35 @@ inline void ps::PServo::_reset_active_action_to_start_again(void) {
 
   _state = State::IN_ACTION;
   _active_action = 0;
+  _is_fresh = true;
 }
 
 ps::PServo *ps::PServo::move(unsigned char const next_pos) {
   using namespace ps;
 
-  return this->move(next_pos, Default::DELAY);
+  return this->move(next_pos,
+                    _is_shared ? _limits.shared->delay : Default::DELAY);
+}
+
+unsigned long ps::PServo::due(void) const {
+  using namespace ps;
+
+  // Anything already late is due now, even when the `_pc` is too old to be
+  // compared with the timer -- like the zero of a scene that was just loaded.
+  unsigned long const now = _has_time() ? _now() : _pc;
+
+  if (not has_scene() or _state != State::IN_ACTION)
+    return now;
+
+  Action const action = _active();
+
+  // It may change on every update, or it's done -- maybe by cutting the
+  // corner of the lookahead mode, before getting there.
+  if (action.profile != Profile::STEP or _is_high_res or
+      _pos == action.pos or _cuts_corner(action.pos))
+    return now;
+
+  return elapsed(_pc, now) >= action.delay ? now : _pc + action.delay;
 }
 
 ps::Props const ps::PServo::props(void) const {
@@ -125,15 +670,27 @@ ps::Props const ps::PServo::props(void) const {
   return Props{
       .state = _state,
       .pc = _pc,
-      .timer = _timer,
-      .min = _min,
-      .max = _max,
+      .timer = _is_clocked ? nullptr : _time.timer,
+      .clock = _is_clocked ? _time.clock : nullptr,
+      .min = _min(),
+      .max = _max(),
       .is_resetable = _is_resetable,
       .curr_action = _curr_action,
       .active_action = _active_action,
       .actions_count = _actions_count,
       .pos = _pos,
       .delay = _delay,
+      .actions = _is_streamed ? nullptr : _actions.table,
+      .is_catching_up = _is_catching_up,
+      .is_high_res = _is_high_res,
+      .frac = _frac,
+      .source = _is_streamed ? _actions.source : nullptr,
+      .profile = _is_shared ? _limits.shared : nullptr,
+      .is_looking_ahead = _is_looking_ahead,
+      .tolerance = _tolerance,
+#if defined(PS_INSTRUMENT)
+      .stats = _stats,
+#endif
   };
 }
 
@@ -143,15 +700,151 @@ void ps::PServo::reset(void) {
 
   _state = State::STANDBY;
   _active_action = 0;
-  _actions_count = 0;
+
+  if (_is_streamed or _actions.table == nullptr) // Tables are still counted.
+    _actions_count = 0;
+
+  if (_is_streamed) // Streamed ones start over from the first action.
+    _actions.source->rewind();
+}
+
+#if defined(PS_INSTRUMENT)
+void ps::PServo::clear_stats(void) { _stats = {}; }
+#endif
+
+void ps::PServo::set_catch_up(bool const is_catching_up) {
+  _is_catching_up = is_catching_up;
+}
+
+void ps::PServo::set_high_res(bool const is_high_res) {
+  _is_high_res = is_high_res;
+  _is_changed = _is_changed or (not is_high_res and _frac != 0);
+  _frac = is_high_res ? _frac : 0;
+}
+
+void ps::PServo::set_lookahead(bool const is_looking_ahead,
+                               unsigned char const tolerance) {
+  _is_looking_ahead = is_looking_ahead;
+  _tolerance = tolerance < Default::TOLERANCE ? tolerance : Default::TOLERANCE;
 }
 
 ps::State const ps::PServo::get_state(void) const { return _state; }
 
 bool ps::PServo::is_state(ps::State s) const { return _state == s; }
 
+bool ps::PServo::has_scene(void) const {
+  return _is_streamed or _actions.table != nullptr;
+}
+
+unsigned char ps::PServo::active_action(void) const { return _active_action; }
+
 unsigned char ps::PServo::pos(void) const { return _pos; }
 
+unsigned char ps::PServo::frac(void) const { return _frac; }
+
+unsigned short ps::PServo::pos_us(void) const {
+  using namespace ps;
+
+  // Microseconds per 1/256 deg, in 1/65536 steps (rounded).
+  unsigned long constexpr SCALE =
+      (((unsigned long)(Default::MAX_PULSE - Default::MIN_PULSE) << 16) +
+       ((unsigned long)Default::MAX << 7)) /
+      ((unsigned long)Default::MAX << 8);
+
+  if (_is_shared and _limits.shared->pulses != nullptr) { // Measured table.
+    unsigned short const *const pulses = _limits.shared->pulses;
+    unsigned char const at = _pos < Default::MAX ? _pos : Default::MAX;
+
+    if (_frac == 0 or at == Default::MAX)
+      return pulses[at];
+
+    long const step = (long)pulses[at + 1] - pulses[at]; // May go backwards.
+
+    return pulses[at] + step * _frac / 256;
+  }
+
+  unsigned long const pos = ((unsigned long)_pos << 8) | _frac;
+
+  if (_is_shared) { // Calibrated, so it can't use the constant scale.
+    ServoProfile const &profile = *_limits.shared;
+    unsigned long const width = profile.max_pulse - profile.min_pulse;
+    unsigned long constexpr RANGE = (unsigned long)Default::MAX << 8;
+
+    return profile.min_pulse + (pos * width + RANGE / 2) / RANGE;
+  }
+
+  return Default::MIN_PULSE + ((pos * SCALE) >> 16);
+}
+
+bool ps::PServo::poll(void) {
+  bool const is_changed = _is_changed;
+
+  _is_changed = false;
+
+  return is_changed;
+}
+
+unsigned short ps::poll(ps::PServo *const *const machines,
+                        unsigned short const count,
+                        unsigned short *const changed) {
+  unsigned short found = 0;
+
+  for (unsigned short i = 0; i < count; ++i) {
+    if (machines[i]->poll())
+      changed[found++] = i;
+  }
+
+  return found;
+}
+
+bool ps::calibrate(ps::Calibration const *const points,
+                   unsigned char const count, unsigned short *const pulses) {
+  using namespace ps;
+
+  if (points == nullptr or pulses == nullptr or count < 2 or
+      points[0].pos != 0 or points[count - 1].pos != Default::MAX)
+    return false;
+
+  for (unsigned char i = 1; i < count; ++i) {
+    if (points[i].pos <= points[i - 1].pos)
+      return false;
+  }
+
+  for (unsigned char i = 1; i < count; ++i) {
+    Calibration const &a = points[i - 1];
+    Calibration const &b = points[i];
+    long const span = b.pos - a.pos;
+    long const width = (long)b.us - a.us;
+
+    for (unsigned char pos = a.pos; pos <= b.pos; ++pos) { // Rounded.
+      long const offset = width * (pos - a.pos);
+
+      pulses[pos] = a.us + (offset + (offset < 0 ? -span : span) / 2) / span;
+    }
+  }
+
+  return true;
+}
+
+unsigned char ps::ease(ps::Profile const profile, unsigned char const phase) {
+  using namespace ps;
+
+  unsigned char const *const table = profile == Profile::TRAPEZOID
+                                         ? TRAPEZOID_TABLE
+                                     : profile == Profile::SCURVE ? SCURVE_TABLE
+                                                                  : nullptr;
+
+  if (table == nullptr)
+    return phase;
+
+  // Linear interpolation between the two closest samples.
+  unsigned char const i = phase >> 3;
+  unsigned char const a = PS_READ_TABLE(table[i]);
+  unsigned char const b = PS_READ_TABLE(table[i + 1]);
+
+  return a + (((b - a) * (phase & 7)) >> 3);
+}
+
 char const *ps::state_text(ps::State s) {
   using namespace ps;
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <stdint.h>
+
+#include "Clock.h"
+
 /*!
  * Precise servo. Holds the core classes, functions and constants related to the
  * state machine that will control the position (it wont write anything
@@ -58,8 +62,176 @@ namespace Default {
 unsigned char constexpr MIN = 0;   //!< Minimal default degree position.
 unsigned char constexpr MAX = 180; //!< Maximum default degree position.
 unsigned char constexpr DELAY = 1; //!< Default delay between movement updates.
+
+unsigned char constexpr TOLERANCE = 15; //!< Greatest lookahead tolerance.
+
+unsigned short constexpr MIN_PULSE = 544;  //!< Pulse width at 0 deg, in us.
+unsigned short constexpr MAX_PULSE = 2400; //!< Pulse width at 180 deg, in us.
 }; // namespace Default
 
+/*!
+ * Configuration of a servo model, shared by every machine that drives one of
+ * them instead of being copied into each machine. Since the machines only
+ * point to it, a change made at runtime -- like a new calibration -- applies
+ * to all of them at once.
+ *
+ * For an example:
+ * ```cpp
+ * ps::ServoProfile sg90 = {0, 180, 15, 500, 2400};
+ *
+ * ps::PServo shoulder(&timer, sg90);
+ * ps::PServo elbow(&timer, sg90, true);
+ *
+ * void setup() {
+ *   sg90.max_pulse = 2350; // Calibrated, for both machines.
+ * }
+ * ```
+ *
+ * @see ps::PServo
+ */
+typedef struct ServoProfile {
+  unsigned char min;            //!< Minimal position of the machines.
+  unsigned char max;            //!< Maximum position of the machines.
+  unsigned short delay;         //!< Delay of the `move()` calls that have none.
+  unsigned short min_pulse;     //!< Pulse width at 0 deg, in us.
+  unsigned short max_pulse;     //!< Pulse width at 180 deg, in us (greater).
+  unsigned short const *pulses; //!< Optional, see `ps::calibrate()`.
+} ServoProfile;
+
+/*!
+ * A pulse width measured for a position of a real servo, used to build the
+ * calibration table of a `ps::ServoProfile` with `ps::calibrate()`.
+ */
+typedef struct Calibration {
+  unsigned char pos; //!< Position, in degrees.
+  unsigned short us; //!< Pulse width for that position, in microseconds.
+} Calibration;
+
+/*!
+ * Shape of the motion from the current position to the next one. The `STEP`
+ * profile is the classic `ps::PServo::move()` behavior, one degree for each
+ * `delay`, and the others are used by `ps::PServo::sweep()`, that takes the
+ * total duration of the movement instead.
+ *
+ * The curves are read from small fixed-point lookup tables, so each update
+ * costs about the same as a `move()` one.
+ *
+ * @see ps::PServo::sweep()
+ * @see ps::ease()
+ */
+enum class Profile : unsigned char {
+  STEP,      //!< One degree for each `delay`, at constant speed.
+  LINEAR,    //!< Constant speed, but over a total duration.
+  TRAPEZOID, //!< Constant acceleration, cruise, then constant deceleration.
+  SCURVE,    //!< Smooth acceleration and deceleration, without jerk spikes.
+};
+
+/*!
+ * A single entry of a compiled scene, it holds the same values that would be
+ * passed to the `ps::PServo::move()` method, but it's stored in a table that
+ * the machine can index directly instead of walking the whole move set on each
+ * loop iteration.
+ *
+ * Usage example:
+ * ```cpp
+ * ps::Action const scene[] = {
+ *     {90, 10},
+ *     {180, 1500, ps::Profile::SCURVE},
+ *     {0, 5},
+ * };
+ *
+ * myservo_machine.load(scene, 3);
+ * ```
+ *
+ * @see ps::PServo::load()
+ * @see ps::PServo::tick()
+ */
+typedef struct Action {
+  unsigned char pos;    //!< Next position that it needs to move to.
+  unsigned short delay; //!< Delay of each degree, or the `sweep()` duration.
+  Profile profile;      //!< Motion profile, defaults to `ps::Profile::STEP`.
+} Action;
+
+/*!
+ * Anything that can hand actions to a machine one at a time, instead of a
+ * whole table in memory, like the `ps::ScenePlayer` that decodes them from a
+ * byte stream. The machine asks for the next action only when the current one
+ * is completed, and keeps that one in the source -- so each source should feed
+ * a single machine.
+ *
+ * @see ps::PServo::play()
+ * @see ps::ScenePlayer
+ */
+class ActionSource {
+public:
+  virtual ~ActionSource() = default;
+
+  /*!
+   * @param action Where the next action should be written to.
+   *
+   * @returns `false` when there is no action available (yet).
+   */
+  virtual bool next(Action *const action) = 0;
+
+  /*!
+   * Goes back to the first action, used by the resetable machines.
+   *
+   * @returns `false` when the source can't start over.
+   */
+  virtual bool rewind(void) { return false; }
+
+  /*!
+   * Tells what the next action will be, without taking it. It's only used by
+   * the lookahead mode (see `ps::PServo::set_lookahead()`).
+   *
+   * @param action Where the next action should be written to.
+   *
+   * @returns `false` when it's not known (yet).
+   */
+  virtual bool peek(Action *const /* action */) { return false; }
+
+private:
+  friend class PServo;
+
+  // The action its machine is performing, kept here so the machines playing a
+  // table don't pay for it.
+  Action _current = {};
+};
+
+/*!
+ * Performance counters of a single machine, only kept when the library is
+ * built with the `PS_INSTRUMENT` macro defined -- otherwise they are compiled
+ * out and cost nothing. Use them to know when the `loop()` function is too
+ * slow for the speed that the scene asks for.
+ *
+ * The time is counted in timer (or clock) units, from one update to the next
+ * -- a `tick()` call, or a `begin()` call for the `move()` chains. Only the
+ * `ps::Profile::STEP` moves have deadlines, the sweeps always catch up.
+ *
+ * For an example, built with `-DPS_INSTRUMENT`:
+ * ```cpp
+ * ps::Stats const stats = myservo_machine.props().stats;
+ *
+ * if (stats.missed > 0) {
+ *   Serial.print("Late by up to ");
+ *   Serial.println(stats.max_lateness);
+ * }
+ * ```
+ *
+ * @see ps::Props
+ * @see ps::PServo::clear_stats()
+ */
+typedef struct Stats {
+  unsigned long ticks;        //!< How much updates the machine had.
+  unsigned long steps;        //!< How much of them changed the position.
+  unsigned long missed;       //!< Steps that came a whole delay late, or more.
+  unsigned long max_lateness; //!< How late the latest step was.
+  unsigned long last;         //!< Timer value of the last update.
+
+  //! Time spent in each `ps::State`, indexed by its value.
+  unsigned long in_state[(unsigned char)State::ERROR_TIMERPTR + 1];
+} Stats;
+
 /*!
  * List of all the private properties of `ps::PServo`. It's primary useful for
  * testing and monitoring strategies, but be aware that you cannot hack those
@@ -88,6 +260,7 @@ typedef struct Props {
   State state;                 //!< Current state of the `ps::PServo` machine.
   unsigned long pc;            //!< Last registered process counter.
   unsigned long *const timer;  //!< Pointer to the timer variable in use.
+  Clock const *const clock;    //!< Clock in use, instead of the timer.
   unsigned char const min;     //!< Minimal position that this machine can be.
   unsigned char const max;     //!< Maximum position that this machine can be.
   bool const is_resetable;     //!< Will the machine reset after it's halted?
@@ -96,6 +269,17 @@ typedef struct Props {
   unsigned char actions_count; //!< How much actions was registred.
   unsigned char pos;           //!< Current servo position, will not be written.
   unsigned short delay;        //!< Delay stored for the current action move.
+  Action const *actions;       //!< Compiled scene table, if it was loaded.
+  bool is_catching_up;         //!< Will it step more than 1 deg when late?
+  bool is_high_res;            //!< Is it tracking fractions of degree?
+  unsigned char frac;          //!< Fraction of degree, in 1/256 steps.
+  ActionSource *source;        //!< Streamed scene source, if it's playing one.
+  ServoProfile const *profile; //!< Shared configuration, if it has one.
+  bool is_looking_ahead;       //!< Does it blend into the next action?
+  unsigned char tolerance;     //!< How close to a waypoint is close enough.
+#if defined(PS_INSTRUMENT)
+  Stats stats; //!< Performance counters, see `ps::Stats`.
+#endif
 } Props;
 
 /*!
@@ -179,7 +363,8 @@ public:
    *
    * @see ps::PServo
    */
-  PServo(unsigned long *const timer) : _timer(timer) {}
+  PServo(unsigned long *const timer)
+      : PServo(timer, false, {Default::MIN, Default::MAX}, false, false) {}
 
   /*!
    * The constructor need, at least, a pointer to a **timer** variable. This
@@ -195,7 +380,8 @@ public:
    * @param is_resetable Configure the machine to reset after it's halted.
    */
   PServo(unsigned long *const timer, bool const is_resetable)
-      : _timer(timer), _is_resetable(is_resetable) {}
+      : PServo(timer, false, {Default::MIN, Default::MAX}, false,
+               is_resetable) {}
 
   /*!
    * The constructor need, at least, a pointer to a **timer** variable. This
@@ -216,7 +402,7 @@ public:
    */
   PServo(unsigned long *const timer, unsigned char const min,
          unsigned char const max)
-      : _timer(timer), _min(min), _max(max) {}
+      : PServo(timer, false, {min, max}, false, false) {}
 
   /*!
    * The constructor need, at least, a pointer to a **timer** variable. This
@@ -238,7 +424,90 @@ public:
    */
   PServo(unsigned long *const timer, unsigned char const min,
          unsigned char const max, bool const is_resetable)
-      : _timer(timer), _min(min), _max(max), _is_resetable(is_resetable) {}
+      : PServo(timer, false, {min, max}, false, is_resetable) {}
+
+  /*!
+   * Same as the constructor that takes the min-max values, but they are read
+   * from a profile shared with other machines (along with the default delay
+   * and the calibration used by `PServo::pos_us()`), which is **not** copied.
+   *
+   * @param timer Pointer to a timer variable, normally related to the
+   * `millis()` function.
+   * @param profile Configuration of the servo model, it should outlive the
+   * machine.
+   * @param is_resetable Configure the machine to reset after it's halted.
+   *
+   * @see ps::ServoProfile
+   */
+  PServo(unsigned long *const timer, ServoProfile const &profile,
+         bool const is_resetable = false)
+      : PServo(timer, false, &profile, true, is_resetable) {}
+
+  /*!
+   * Same as the constructor that takes a timer pointer, but the machine reads
+   * the time from a clock by itself -- once per `tick()`, or in `begin()` and
+   * the active `move()` of a chain -- so the sketch doesn't need to update any
+   * variable. The clock can't be a null pointer, so the machine never ends up
+   * in the `ps::State::ERROR_TIMERPTR` state.
+   *
+   * For an example:
+   * ```cpp
+   * ps::FunctionClock<millis> clock;
+   *
+   * ps::PServo myservo_machine(clock);
+   * ```
+   *
+   * @param clock Where the time is read from, it should outlive the machine.
+   *
+   * @see ps::Clock
+   */
+  PServo(Clock const &clock)
+      : PServo(&clock, true, {Default::MIN, Default::MAX}, false, false) {}
+
+  /*!
+   * @param clock Where the time is read from, it should outlive the machine.
+   * @param is_resetable Configure the machine to reset after it's halted.
+   *
+   * @see ps::Clock
+   */
+  PServo(Clock const &clock, bool const is_resetable)
+      : PServo(&clock, true, {Default::MIN, Default::MAX}, false,
+               is_resetable) {}
+
+  /*!
+   * @param clock Where the time is read from, it should outlive the machine.
+   * @param min Minimul position value that this machine can be.
+   * @param max Maximum position value that this machine can be.
+   *
+   * @see ps::Clock
+   */
+  PServo(Clock const &clock, unsigned char const min, unsigned char const max)
+      : PServo(&clock, true, {min, max}, false, false) {}
+
+  /*!
+   * @param clock Where the time is read from, it should outlive the machine.
+   * @param min Minimul position value that this machine can be.
+   * @param max Maximum position value that this machine can be.
+   * @param is_resetable Configure the machine to reset after it's halted.
+   *
+   * @see ps::Clock
+   */
+  PServo(Clock const &clock, unsigned char const min, unsigned char const max,
+         bool const is_resetable)
+      : PServo(&clock, true, {min, max}, false, is_resetable) {}
+
+  /*!
+   * @param clock Where the time is read from, it should outlive the machine.
+   * @param profile Configuration of the servo model, it should outlive the
+   * machine.
+   * @param is_resetable Configure the machine to reset after it's halted.
+   *
+   * @see ps::Clock
+   * @see ps::ServoProfile
+   */
+  PServo(Clock const &clock, ServoProfile const &profile,
+         bool const is_resetable = false)
+      : PServo(&clock, true, &profile, true, is_resetable) {}
 
   /*!
    * This function is the most important one, it should be used everytime at the
@@ -277,6 +546,32 @@ public:
    */
   PServo *begin(void);
 
+  /*!
+   * Same as the `PServo::begin()` method, but the amount of `move()` calls
+   * that follows it is declared up front. So, instead of spending the whole
+   * first loop iteration just counting the actions, the machine goes straight
+   * to the `ps::State::IN_ACTION` state and the first action starts on that
+   * same iteration -- also after each `PServo::reset()`.
+   *
+   * For an example:
+   * ```cpp
+   * myservo_machine.begin(3)
+   *   ->move(90, 10)
+   *   ->move(180, 50)
+   *   ->move(0, 30);
+   * ```
+   *
+   * > **Note**: The declared amount should match the `move()` calls, an extra
+   * > call will be ignored, and a missing one will make the machine wait for
+   * > an action that never comes.
+   *
+   * @param actions_count How much `move()` calls follows this one.
+   *
+   * @returns A pointer to this same object, allowing the use of the `->` syntax
+   * to write a stream of actions that this state machine will perform.
+   */
+  PServo *begin(unsigned char const actions_count);
+
   /*!
    * This function just calls it self again, but passing the
    * `ps::Default::DELAY` as a seccodary parameter to move (or, in this context,
@@ -324,6 +619,155 @@ public:
    */
   PServo *move(unsigned char const next_pos, unsigned short const delay);
 
+  /*!
+   * Same as the `PServo::move()` method, but instead of a delay between each
+   * degree, it takes the total duration of the movement and follows a motion
+   * profile -- like a trapezoidal or an S-curve one, which accelerates and
+   * decelerates smoothly. It lets the servos run faster on long sweeps without
+   * mechanical overshoot.
+   *
+   * The target is clamped between the min-max limits, and the movement always
+   * ends exactly `duration` time units after it started. Sweeping to the same
+   * position the servo is already at will just hold it there for that long.
+   *
+   * For an example:
+   * ```cpp
+   * myservo_machine.begin()
+   *   ->sweep(180, 1500, ps::Profile::SCURVE)
+   *   ->sweep(180, 500, ps::Profile::LINEAR) // Wait for half a second.
+   *   ->move(0, 10);
+   * ```
+   *
+   * @param next_pos Next position that it needs to move to.
+   * @param duration Total duration of the movement, in timer units.
+   * @param profile Shape of the motion, see `ps::Profile`.
+   *
+   * @returns A pointer to this same object, allowing the use of the `->` syntax
+   * to write a stream of actions that this state machine will perform.
+   */
+  PServo *sweep(unsigned char const next_pos, unsigned short const duration,
+                Profile const profile);
+
+  /*!
+   * Registers a compiled scene, a table of actions that will be performed one
+   * after another by the `PServo::tick()` method. Since the amount of actions
+   * is already known, there is no counting pass, the machine goes straight to
+   * the `ps::State::IN_ACTION` state.
+   *
+   * The table is **not** copied, so it should live as long as the machine is
+   * using it -- a global or `static` array is the usual choice. Don't mix this
+   * with the `begin()`/`move()` chain on the same machine.
+   *
+   * For an example:
+   * ```cpp
+   * ps::Action const scene[] = {{90, 10}, {180, 25}, {0, 5}};
+   *
+   * void setup() {
+   *   myservo_machine.load(scene, 3);
+   * }
+   *
+   * void loop() {
+   *   timer = millis();
+   *
+   *   myservo.write(myservo_machine.pos());
+   *   myservo_machine.tick();
+   * }
+   * ```
+   *
+   * @param actions Table with each action that this machine should perform.
+   * @param actions_count How much actions there are in the `actions` table.
+   *
+   * @returns A pointer to this same object.
+   *
+   * @see ps::Action
+   */
+  PServo *load(Action const *const actions, unsigned char const actions_count);
+
+  /*!
+   * Same as `PServo::load()`, but for a table stored in the flash memory of an
+   * AVR board, with the `PROGMEM` attribute -- so the scene takes no RAM, only
+   * the action that is being performed is copied on each update. On any other
+   * target, it's just a `PServo::load()` call.
+   *
+   * For an example:
+   * ```cpp
+   * ps::Action const scene[] PROGMEM = {{90, 10}, {180, 25}, {0, 5}};
+   *
+   * void setup() {
+   *   myservo_machine.load_progmem(scene, 3);
+   * }
+   * ```
+   *
+   * @param actions Table stored in the flash memory, it's **not** copied.
+   * @param actions_count How much actions there are in the `actions` table.
+   *
+   * @returns A pointer to this same object.
+   *
+   * @see ps::Scene
+   */
+  PServo *load_progmem(Action const *const actions,
+                       unsigned char const actions_count);
+
+  /*!
+   * Same as `PServo::load()`, but the actions are pulled one by one from a
+   * source, when the previous one is completed, so the scene can be as long
+   * as needed without using any more memory. The machine keeps a copy of the
+   * current action only, and it's also driven by the `PServo::tick()` method.
+   *
+   * When the source runs out of actions, the machine halts -- or, if it's
+   * resetable, it rewinds the source and starts over. A halted machine keeps
+   * asking the source on each `tick()`, so it moves again if new actions show
+   * up, like on a `ps::Queue`.
+   *
+   * For an example:
+   * ```cpp
+   * ps::ProgmemSource bytes(scene_bin, sizeof(scene_bin));
+   * ps::ScenePlayer player(&bytes);
+   *
+   * void setup() {
+   *   myservo_machine.play(&player);
+   * }
+   * ```
+   *
+   * @param source Where the actions will be pulled from.
+   *
+   * @returns A pointer to this same object.
+   *
+   * @see ps::ActionSource
+   * @see ps::ScenePlayer
+   */
+  PServo *play(ActionSource *const source);
+
+  /*!
+   * Same as calling `begin()` followed by all the `move()` calls of the scene,
+   * but for a scene registered with `PServo::load()`. Instead of walking
+   * through every action to find the active one, it jumps straight to its
+   * entry in the table, so the cost of each call doesn't grow with the scene
+   * length.
+   *
+   * Since this function is asynchronous, it **should be called every time in
+   * the `loop()` function**!
+   *
+   * @returns A pointer to this same object.
+   */
+  PServo *tick(void);
+
+  /*!
+   * Tells when the next `tick()` call will, actually, change something on a
+   * machine running a compiled scene. It's what allows the `ps::Scheduler` to
+   * sleep until the next servo needs to be updated, instead of polling every
+   * machine on each loop iteration.
+   *
+   * When the machine is not in the `ps::State::IN_ACTION` state, or when the
+   * active action should be updated right away, it returns the current timer
+   * value, which means *now*.
+   *
+   * @returns The timer value that the next update is expected at.
+   *
+   * @see ps::Scheduler
+   */
+  unsigned long due(void) const;
+
   /*!
    * This method allows the user to inspect all the private attributes of the
    * object. It's quite useful for loggin or monitoring sketches, or maybe to
@@ -335,6 +779,15 @@ public:
    */
   Props const props(void) const;
 
+#if defined(PS_INSTRUMENT)
+  /*!
+   * Zeroes all the performance counters, to measure a new period of time.
+   *
+   * @see ps::Stats
+   */
+  void clear_stats(void);
+#endif
+
   /*!
    * Used to know which state the machine is currently in. Used to catch state
    * and handle state errors or build complex systems that behaves differently
@@ -353,6 +806,25 @@ public:
    */
   bool is_state(State s) const;
 
+  /*!
+   * Cheaper than checking the `actions` and `source` fields of the
+   * `PServo::props()` struct, used on the hot path of the `ps::Scheduler`.
+   *
+   * @returns Was a compiled scene loaded, or a streamed one played?
+   *
+   * @see ps::PServo::load()
+   * @see ps::PServo::play()
+   */
+  bool has_scene(void) const;
+
+  /*!
+   * Cheaper than the `active_action` field of the `PServo::props()` struct,
+   * used on the hot path of the `ps::Trace` recorder.
+   *
+   * @returns Which action is, actually, performing.
+   */
+  unsigned char active_action(void) const;
+
   /*!
    * Used to get the current servo position, in order to mirror this value to a
    * real servo, which will write that value position every time on the `loop()`
@@ -363,10 +835,64 @@ public:
    */
   unsigned char pos(void) const;
 
+  /*!
+   * @returns The fraction of degree past `PServo::pos()`, in 1/256 steps. It's
+   * always `0` outside of the high resolution mode.
+   *
+   * @see ps::PServo::set_high_res()
+   */
+  unsigned char frac(void) const;
+
+  /*!
+   * Same as `PServo::pos()`, but converted to the pulse width that a servo
+   * expects for that position, in microseconds -- it can be written with the
+   * `Servo::writeMicroseconds()` method. In the high resolution mode, the
+   * fraction of degree is also taken into account.
+   *
+   * The conversion uses the `ps::Default::MIN_PULSE` and
+   * `ps::Default::MAX_PULSE` values, same as the `Servo.h` library, and it's
+   * done with a multiplication and a shift only. A machine with a shared
+   * profile uses its calibration instead: a lookup in its table (see
+   * `ps::calibrate()`), or the `min_pulse` and `max_pulse` values at the cost
+   * of a division.
+   *
+   * @returns The pulse width for the current position, in microseconds.
+   *
+   * @see ps::PServo::set_high_res()
+   */
+  unsigned short pos_us(void) const;
+
+  /*!
+   * The position changes, at most, once per `delay`, so writing it to the
+   * servo on every loop iteration is mostly redundant -- and with lots of
+   * servos behind an I2C PWM expander, that's most of the bus bandwidth. This
+   * method tells when there is something new to write. In the high resolution
+   * mode, a change of the fraction of degree also counts.
+   *
+   * ```cpp
+   * void loop() {
+   *   timer = millis();
+   *
+   *   if (myservo_machine.poll())
+   *     myservo.write(myservo_machine.pos());
+   *
+   *   myservo_machine.tick();
+   * }
+   * ```
+   *
+   * @returns Has the position moved since the last call? The first call
+   * always says it has.
+   *
+   * @see ps::poll()
+   */
+  bool poll(void);
+
   /*!
    * Resets the machine state back to the SANTDBY, the counter of actions is
-   * also reset to 0. It's useful when you want to use a scene based moveset
-   * pattern. For an example:
+   * also reset to 0 -- unless a compiled scene was loaded, or a streamed one
+   * (that is rewound), in that case the next `tick()` call will start it over
+   * again. It's useful when you want to use a scene based moveset pattern. For
+   * an example:
    *
    * ```cpp
    * switch (curr_scene) {
@@ -396,22 +922,193 @@ public:
    */
   void reset(void);
 
+  /*!
+   * By default, the machine moves only one degree for each `move()` call, even
+   * when the timer has advanced several delays since the last update -- so a
+   * slow or jittery `loop()` makes the servo fall behind the speed that the
+   * scene asked for.
+   *
+   * When the catch-up mode is enabled, the machine computes how much delays
+   * have passed and moves that many degrees at once, never going further than
+   * the target nor out of the min-max limits. The leftover time is kept for the
+   * next update, so the servo keeps the real-time speed no matter how often the
+   * `loop()` function runs.
+   *
+   * ```cpp
+   * void setup() {
+   *   myservo_machine.set_catch_up(true);
+   * }
+   * ```
+   *
+   * > **Note**: Since a scene can start long after the board booted up, the
+   * > machine will start counting the time from the first action of the scene
+   * > in this mode, instead of moving right away.
+   *
+   * @param is_catching_up Should the machine catch up with the timer or not.
+   */
+  void set_catch_up(bool const is_catching_up);
+
+  /*!
+   * By default, the position has a resolution of one degree, so a slow move
+   * is a series of one degree jumps, and the `delay` is the only way to tune
+   * its speed. In the high resolution mode, the machine also tracks the
+   * fraction of degree (in 1/256 steps) and moves continuously, at the speed
+   * that the `delay` between each degree defines -- use `PServo::pos_us()` to
+   * write it to the servo with that precision.
+   *
+   * All the math still uses integers only, so it's cheap on AVR boards too.
+   *
+   * ```cpp
+   * void setup() {
+   *   myservo_machine.set_high_res(true);
+   * }
+   *
+   * void loop() {
+   *   timer = millis();
+   *
+   *   myservo.writeMicroseconds(myservo_machine.pos_us());
+   *
+   *   myservo_machine.begin()->move(180, 250)->move(0, 250);
+   * }
+   * ```
+   *
+   * @param is_high_res Should the machine track fractions of degree or not.
+   */
+  void set_high_res(bool const is_high_res);
+
+  /*!
+   * By default, each action is completed before the next one starts, so the
+   * eased sweeps slow down to a full stop at every waypoint of a path. In the
+   * lookahead mode, the machine looks at the next action of the scene while
+   * it performs the current one, like the junction planner of a CNC machine:
+   *
+   * - When two sweeps go the same way, the first one doesn't decelerate and
+   *   the second one doesn't accelerate, the servo keeps going through the
+   *   waypoint (still right on time).
+   * - Otherwise, the machine starts the next action as soon as it's within
+   *   `tolerance` degrees of the waypoint, skipping the slowest part of the
+   *   movement. Actions shorter than the tolerance are never cut, neither is
+   *   the last action of a scene that doesn't reset. It goes up to
+   *   `ps::Default::TOLERANCE` degrees, a greater one is clamped.
+   *
+   * It only works with compiled scenes (`PServo::load()`) and sources that can
+   * peek their next action (`PServo::play()`), a `move()` chain doesn't know
+   * what comes next.
+   *
+   * ```cpp
+   * void setup() {
+   *   myservo_machine.set_lookahead(true, 2); // Cut corners up to 2 degrees.
+   *   myservo_machine.load(path, 5);
+   * }
+   * ```
+   *
+   * @param is_looking_ahead Should the machine blend the actions or not.
+   * @param tolerance How far from each waypoint it can turn, in degrees.
+   */
+  void set_lookahead(bool const is_looking_ahead,
+                     unsigned char const tolerance = 0);
+
 private:
   State _state = State::STANDBY;
 
   unsigned long _pc = 0;
-  unsigned long *const _timer = nullptr;
 
-  unsigned char _min = Default::MIN;
-  unsigned char _max = Default::MAX;
-  bool _is_resetable = false;
+  // Either a timer pointer or a clock, so only one of them takes space (see
+  // the `_is_clocked` flag).
+  union Time {
+    Time(unsigned long *const timer) : timer(timer) {}
+    Time(Clock const *const clock) : clock(clock) {}
+
+    unsigned long *timer;
+    Clock const *clock;
+  } const _time;
+
+  // Its own min-max limits, or a profile shared with other machines, that
+  // takes the same space on an AVR board (see the `_is_shared` flag).
+  union Limits {
+    Limits(unsigned char const min, unsigned char const max) : own{min, max} {}
+    Limits(ServoProfile const *const shared) : shared(shared) {}
+
+    unsigned char own[2];
+    ServoProfile const *shared;
+  } _limits;
+
+  // Packed into two bytes, so they are set by the constructor.
+  bool _is_clocked : 1;
+  bool _is_shared : 1;
+  bool _is_resetable : 1;
+  bool _is_catching_up : 1;
+  bool _is_high_res : 1;
+  bool _is_fresh : 1;
+  bool _is_looking_ahead : 1;
+  bool _is_streamed : 1;     // Is it playing a source, instead of a table?
+  bool _is_progmem : 1;      // Is the `_actions` table in the flash memory?
+  bool _is_blending_in : 1;  // Starts at the speed the last one ended.
+  bool _is_blending_out : 1; // Ends at speed, without decelerating.
+  bool _is_changed : 1;         // Has it moved since the last `poll()`?
+  unsigned char _tolerance : 4; // Up to `Default::TOLERANCE`, in the flags.
 
   unsigned char _curr_action = 0;
   unsigned char _active_action = 0;
   unsigned char _actions_count = 0;
   unsigned char _pos = 0;
+  unsigned char _frac = 0;
+  unsigned char _origin = 0;
+  unsigned char _phase = 0; // Of the sweeps, in 1/256 of their duration.
   unsigned short _delay = Default::DELAY;
 
+  // A compiled scene or a streamed one, never both (see the `_is_streamed`
+  // flag). The action taken from a source is kept in the source itself.
+  union Actions {
+    Action const *table;
+    ActionSource *source;
+  } _actions = {};
+
+  // Every public constructor ends up here.
+  PServo(Time const time, bool const is_clocked, Limits const limits,
+         bool const is_shared, bool const is_resetable)
+      : _time(time), _limits(limits), _is_clocked(is_clocked),
+        _is_shared(is_shared), _is_resetable(is_resetable),
+        _is_catching_up(false), _is_high_res(false), _is_fresh(true),
+        _is_looking_ahead(false), _is_streamed(false), _is_progmem(false),
+        _is_blending_in(false), _is_blending_out(false), _is_changed(true),
+        _tolerance(0) {}
+
+#if defined(PS_INSTRUMENT)
+  Stats _stats = {};
+  bool _is_timed = false; // Does the `_pc` hold a real deadline?
+
+  inline void _observe(unsigned long const now);
+#endif
+
+  inline PServo *_update(unsigned long const now);
+  inline bool _has_time(void) const;
+  inline unsigned char _min(void) const;
+  inline unsigned char _max(void) const;
+  inline unsigned char _clamp(unsigned char const pos) const;
+  inline unsigned long _now(void) const;
+  inline Action _active(void) const;
+  inline Action _action_at(unsigned char const i) const;
+  inline bool _pull(void);
+  inline void _step(unsigned char const next_pos, unsigned short const delay,
+                    unsigned long const now);
+  inline void _glide(unsigned char const next_pos, unsigned short const delay,
+                     unsigned long const now);
+  inline void _place(unsigned short const pos);
+  inline void _sweep(unsigned char const next_pos,
+                     unsigned short const duration, Profile const profile,
+                     unsigned long const now);
+  inline void _linear(unsigned char const target,
+                      unsigned short const duration,
+                      unsigned long const passed);
+  inline unsigned char _curve(Profile const profile,
+                              unsigned char const phase) const;
+  inline bool _upcoming(Action *const action) const;
+  inline bool _blends_into(unsigned char const target) const;
+  inline bool _cuts_corner(unsigned char const target) const;
+  inline void _perform(Action const &action, unsigned long const now);
+  inline PServo *_chain(Action const &action);
+  inline void _start_scene(unsigned long const now);
   inline void _reset_active_action_to_start_again(void);
   inline void _reset_or_update_and_start_next_action(void);
 };
@@ -436,4 +1133,105 @@ private:
  * @see ps::State
  */
 char const *state_text(State s);
+
+/*!
+ * Same as calling `ps::PServo::poll()` on each machine, but it gives only the
+ * ones whose position has changed, so the output driver can skip the others.
+ *
+ * Usage example:
+ * ```cpp
+ * ps::PServo *const machines[] = {&shoulder, &elbow, &wrist};
+ * unsigned short changed[3];
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   unsigned short const count = ps::poll(machines, 3, changed);
+ *
+ *   for (unsigned short i = 0; i < count; ++i)
+ *     pwm.setPWM(changed[i], 0, machines[changed[i]]->pos_us());
+ *
+ *   // Tick the machines...
+ * }
+ * ```
+ *
+ * @param machines The machines to be polled.
+ * @param count How much machines there are.
+ * @param changed Where the index of each changed machine is written to, it
+ * should have room for `count` of them.
+ *
+ * @returns How much machines have changed.
+ */
+unsigned short poll(PServo *const *const machines, unsigned short const count,
+                    unsigned short *const changed);
+
+/*!
+ * Real servos are not linear, the same pulse width step moves them more in
+ * some parts of the range than in others. This function builds a table with
+ * the pulse width of each degree, from a few measured points -- linear between
+ * each pair of points -- so `ps::PServo::pos_us()` gives the corrected value
+ * with a lookup, without any arithmetic on each update.
+ *
+ * The table has `ps::Default::MAX + 1` (181) entries and should be set in the
+ * `ps::ServoProfile::pulses` field. Use one profile per servo when each one has
+ * its own calibration. It can be rebuilt at runtime, while the machines run.
+ *
+ * Usage example:
+ * ```cpp
+ * ps::Calibration const measured[] = {{0, 520}, {90, 1430}, {180, 2390}};
+ * unsigned short pulses[181];
+ *
+ * ps::ServoProfile sg90 = {0, 180, 15, 520, 2390, pulses};
+ *
+ * void setup() {
+ *   ps::calibrate(measured, 3, pulses);
+ * }
+ * ```
+ *
+ * @param points Measured points, sorted by position, from 0 to 180 degrees.
+ * @param count How much points there are, at least 2.
+ * @param pulses Table to be filled, with 181 entries.
+ *
+ * @returns `false` if the points are not valid, the table is untouched.
+ */
+bool calibrate(Calibration const *const points, unsigned char const count,
+               unsigned short *const pulses);
+
+/*!
+ * Evaluates a motion profile curve, that's what `ps::PServo::sweep()` uses to
+ * know where the servo should be at each moment of the movement. Both values
+ * are fixed-point fractions, where `0` is the start and `255` is (almost) the
+ * end of the movement.
+ *
+ * @param profile Shape of the motion, the `ps::Profile::STEP` is handled as
+ * the `ps::Profile::LINEAR` one.
+ * @param phase How much of the duration has passed.
+ *
+ * @returns How much of the distance should be covered at that moment.
+ */
+unsigned char ease(Profile const profile, unsigned char const phase);
+
+/*!
+ * How much time has passed between two timer values, always computed with 32
+ * bits, like the `millis()` and `micros()` counters -- so it's still right
+ * after they wrap around, even on a host where `unsigned long` has 64 bits.
+ * The `micros()` counter wraps every 71 minutes, for an example.
+ *
+ * Usage example:
+ * ```cpp
+ * unsigned long const start = 0xFFFFFFF0;
+ * unsigned long const now = 0x00000010; // Wrapped around.
+ *
+ * ps::elapsed(start, now); // 32, not a huge number.
+ * ```
+ *
+ * @param since The oldest timer value.
+ * @param now The newest timer value.
+ *
+ * @returns The time between them, from `0` to `0xFFFFFFFF`.
+ */
+inline unsigned long elapsed(unsigned long const since,
+                             unsigned long const now) {
+  return (uint32_t)(now - since);
+}
 }; // namespace ps
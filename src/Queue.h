@@ -0,0 +1,135 @@
+#pragma once
+
+#include "PServo.h"
+
+namespace ps {
+/*!
+ * Lock-free ring buffer of actions, for a single producer and a single
+ * consumer, that a machine can play (see `ps::PServo::play()`). The producer
+ * can be an interrupt routine, like a serial receive one, or another thread on
+ * the host, while the machine consumes it on its `ps::PServo::tick()` calls.
+ * Neither side ever blocks or disables the interrupts: the producer just gets
+ * a `false` when the queue is full.
+ *
+ * While the queue is empty, a machine playing it halts, and it starts moving
+ * again as soon as a new action arrives.
+ *
+ * For an example:
+ * ```cpp
+ * ps::Queue<8> commands;
+ *
+ * void serialEvent() {
+ *   while (Serial.available() >= 3) {
+ *     unsigned char const pos = Serial.read();
+ *     // Low byte first, read apart since the `|` operands can go in any order.
+ *     unsigned char const low = Serial.read();
+ *     unsigned char const high = Serial.read();
+ *
+ *     commands.push(ps::Action{pos, (unsigned short)(low | high << 8)});
+ *   }
+ * }
+ *
+ * void setup() {
+ *   myservo_machine.play(&commands);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   myservo.write(myservo_machine.pos());
+ *   myservo_machine.tick();
+ * }
+ * ```
+ *
+ * @see ps::ActionSource
+ */
+template <unsigned char N> class Queue : public ActionSource {
+  static_assert(N > 0 and N <= 128 and (N & (N - 1)) == 0,
+                "The capacity should be a power of 2, up to 128.");
+
+public:
+  /*!
+   * Producer side, adds an action at the end of the queue.
+   *
+   * @param action The action to be performed.
+   *
+   * @returns `false` if the queue is full, the action is dropped.
+   */
+  bool push(Action const &action) {
+    unsigned char const head = __atomic_load_n(&_head, __ATOMIC_RELAXED);
+    unsigned char const tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+
+    if ((unsigned char)(head - tail) >= N)
+      return false;
+
+    _actions[head & (N - 1)] = action;
+    __atomic_store_n(&_head, (unsigned char)(head + 1), __ATOMIC_RELEASE);
+
+    return true;
+  }
+
+  /*!
+   * Consumer side, takes the first action out of the queue. It's what the
+   * machine calls when its current action is completed.
+   *
+   * @param action Where the action should be written to.
+   *
+   * @returns `false` if the queue is empty.
+   */
+  bool next(Action *const action) override {
+    unsigned char const tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+    unsigned char const head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+      return false;
+
+    *action = _actions[tail & (N - 1)];
+    __atomic_store_n(&_tail, (unsigned char)(tail + 1), __ATOMIC_RELEASE);
+
+    return true;
+  }
+
+  /*!
+   * Consumer side too, same as `Queue::next()` but the action stays in the
+   * queue. Used by the machines in the lookahead mode.
+   *
+   * @param action Where the action should be written to.
+   *
+   * @returns `false` if the queue is empty.
+   */
+  bool peek(Action *const action) override {
+    unsigned char const tail = __atomic_load_n(&_tail, __ATOMIC_RELAXED);
+    unsigned char const head = __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+
+    if (head == tail)
+      return false;
+
+    *action = _actions[tail & (N - 1)];
+
+    return true;
+  }
+
+  /*!
+   * @returns How much actions are waiting, it may be already outdated when the
+   * other side is running at the same time.
+   */
+  unsigned char size(void) const {
+    return __atomic_load_n(&_head, __ATOMIC_ACQUIRE) -
+           __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+  }
+
+  /*!
+   * @returns How much actions it can hold.
+   */
+  unsigned char capacity(void) const { return N; }
+
+private:
+  Action _actions[N];
+
+  // Free running counters, only the producer writes the head and only the
+  // consumer writes the tail. A single byte is always read and written at
+  // once, even on AVR boards.
+  unsigned char _head = 0;
+  unsigned char _tail = 0;
+};
+}; // namespace ps
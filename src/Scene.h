@@ -0,0 +1,171 @@
+#pragma once
+
+#include "PServo.h"
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#define PS_PROGMEM PROGMEM
+#else
+#define PS_PROGMEM
+#endif
+
+namespace ps {
+/*!
+ * A single move of a compile-time scene, same parameters of the
+ * `ps::PServo::move()` method, but as template arguments. When a `Profile`
+ * other than `ps::Profile::STEP` is given, it works like the
+ * `ps::PServo::sweep()` method and `Delay` is the total duration.
+ *
+ * @see ps::Scene
+ */
+template <unsigned char Pos, unsigned short Delay = Default::DELAY,
+          Profile P = Profile::STEP>
+struct Move {
+  static unsigned char constexpr pos = Pos;      //!< Next position.
+  static unsigned short constexpr delay = Delay; //!< Delay or duration.
+  static Profile constexpr profile = P;          //!< Motion profile.
+};
+
+// Definitions of the members above, needed when they are taken by reference
+// before C++17 -- like the `-std=gnu++11` of the AVR boards.
+template <unsigned char Pos, unsigned short Delay, Profile P>
+unsigned char constexpr Move<Pos, Delay, P>::pos;
+
+template <unsigned char Pos, unsigned short Delay, Profile P>
+unsigned short constexpr Move<Pos, Delay, P>::delay;
+
+template <unsigned char Pos, unsigned short Delay, Profile P>
+Profile constexpr Move<Pos, Delay, P>::profile;
+
+/*!
+ * Helpers used to compute the scene values at compile time, all of them are
+ * written as a single `return` statement to work with C++11 compilers.
+ */
+namespace scene {
+constexpr unsigned char clamp(unsigned char const pos, unsigned char const min,
+                              unsigned char const max) {
+  return pos < min ? min : pos > max ? max : pos;
+}
+
+constexpr unsigned long distance(unsigned char const from,
+                                 unsigned char const to) {
+  return from < to ? to - from : from - to;
+}
+
+constexpr unsigned long time(unsigned char const from, unsigned char const to,
+                             unsigned short const delay,
+                             Profile const profile) {
+  return profile == Profile::STEP ? distance(from, to) * delay : delay;
+}
+
+template <unsigned char Min, unsigned char Max, unsigned char From,
+          typename... Moves>
+struct Duration {
+  static unsigned long constexpr value = 0;
+};
+
+template <unsigned char Min, unsigned char Max, unsigned char From,
+          typename M, typename... Moves>
+struct Duration<Min, Max, From, M, Moves...> {
+  static unsigned long constexpr value =
+      time(From, clamp(M::pos, Min, Max), M::delay, M::profile) +
+      Duration<Min, Max, clamp(M::pos, Min, Max), Moves...>::value;
+};
+}; // namespace scene
+
+/*!
+ * A scene defined at compile time, where the amount of actions, the total
+ * duration and the targets -- already clamped between the `Min` and `Max`
+ * limits -- are all computed by the compiler. It doesn't need the counting
+ * pass that `ps::PServo::begin()` does on the first loop iteration, the
+ * machine starts moving on the very first `ps::PServo::tick()`.
+ *
+ * The `Min` and `Max` values should be the same ones passed to the machine
+ * constructor, otherwise a target out of the machine limits would never be
+ * reached.
+ *
+ * On AVR boards the table is stored in the flash memory (`PROGMEM`), so a scene
+ * takes no RAM at all -- the machine copies only the action it's performing
+ * (see `ps::PServo::load_progmem()`).
+ *
+ * For an example:
+ * ```cpp
+ * typedef ps::LimitedScene<0, 180, ps::Move<90, 5>, ps::Move<180, 20>,
+ *                          ps::Move<0, 5>>
+ *     Wave;
+ *
+ * static_assert(Wave::duration == 3150, "Should take about 3 seconds.");
+ *
+ * void setup() {
+ *   Wave::load(myservo_machine);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   myservo.write(myservo_machine.pos());
+ *   myservo_machine.tick();
+ * }
+ * ```
+ *
+ * @see ps::Scene
+ * @see ps::Move
+ */
+template <unsigned char Min, unsigned char Max, typename... Moves>
+struct LimitedScene {
+  static_assert(sizeof...(Moves) > 0, "A scene needs at least one move.");
+  static_assert(sizeof...(Moves) < 256, "A scene can't have 256+ moves.");
+
+  /*!
+   * How much actions there are in the scene.
+   */
+  static unsigned char constexpr count = sizeof...(Moves);
+
+  /*!
+   * The whole scene duration, in timer units, starting from the minimal
+   * position (which is where a new machine starts at) and without counting
+   * the loop iterations that the machine takes to notice each completed move.
+   */
+  static unsigned long constexpr duration =
+      scene::Duration<Min, Max, Min, Moves...>::value;
+
+  /*!
+   * The compiled table, in the flash memory of AVR boards, ready to be used by
+   * `ps::PServo::load_progmem()`.
+   */
+  static Action constexpr actions[] PS_PROGMEM = {
+      {scene::clamp(Moves::pos, Min, Max), Moves::delay, Moves::profile}...};
+
+  /*!
+   * Loads this scene into a machine, same as calling
+   * `machine.load_progmem(actions, count)`.
+   *
+   * @param machine The state machine that will perform the scene.
+   *
+   * @returns A pointer to the machine.
+   */
+  static PServo *load(PServo &machine) {
+    return machine.load_progmem(actions, count);
+  }
+};
+
+template <unsigned char Min, unsigned char Max, typename... Moves>
+unsigned char constexpr LimitedScene<Min, Max, Moves...>::count;
+
+template <unsigned char Min, unsigned char Max, typename... Moves>
+unsigned long constexpr LimitedScene<Min, Max, Moves...>::duration;
+
+template <unsigned char Min, unsigned char Max, typename... Moves>
+Action constexpr LimitedScene<Min, Max, Moves...>::actions[] PS_PROGMEM;
+
+/*!
+ * Same as `ps::LimitedScene`, but using the `ps::Default` limits.
+ *
+ * For an example:
+ * ```cpp
+ * typedef ps::Scene<ps::Move<90, 5>, ps::Move<180, 20>, ps::Move<0, 5>> Wave;
+ * ```
+ */
+template <typename... Moves>
+using Scene = LimitedScene<Default::MIN, Default::MAX, Moves...>;
+}; // namespace ps
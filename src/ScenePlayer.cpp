@@ -0,0 +1,120 @@
+#include "ScenePlayer.h"
+
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#endif
+
+static_assert(ps::format::HEADER_SIZE <= ps::format::RECORD_SIZE,
+              "The header is read into the same buffer of the records.");
+
+ps::MemorySource::MemorySource(unsigned char const *const data,
+                               unsigned long const size)
+    : _data(data), _size(data == nullptr ? 0 : size) {}
+
+int ps::MemorySource::read(void) {
+  return _at < _size ? _data[_at++] : -1;
+}
+
+bool ps::MemorySource::rewind(void) {
+  _at = 0;
+  return true;
+}
+
+int ps::ProgmemSource::read(void) {
+#if defined(__AVR__)
+  return _at < _size ? pgm_read_byte(_data + _at++) : -1;
+#else
+  return MemorySource::read();
+#endif
+}
+
+ps::ScenePlayer::ScenePlayer(ps::ByteSource *const bytes) : _bytes(bytes) {}
+
+bool ps::ScenePlayer::next(ps::Action *const action) {
+  if (not _has_ahead)
+    _fetch();
+
+  if (not _has_ahead)
+    return false;
+
+  *action = _ahead;
+  _has_ahead = false;
+
+  _fetch(); // Keep one action ahead of the machine.
+
+  return true;
+}
+
+bool ps::ScenePlayer::peek(ps::Action *const action) {
+  if (not _has_ahead)
+    _fetch();
+
+  if (not _has_ahead)
+    return false;
+
+  *action = _ahead;
+
+  return true;
+}
+
+bool ps::ScenePlayer::rewind(void) {
+  if (_bytes == nullptr or not _bytes->rewind())
+    return false;
+
+  _filled = 0;
+  _has_header = false;
+  _has_ahead = false;
+  _is_valid = true;
+
+  return true;
+}
+
+bool ps::ScenePlayer::is_valid(void) const { return _is_valid; }
+
+bool ps::ScenePlayer::_read(unsigned char const size) {
+  while (_filled < size) {
+    int const byte = _bytes->read();
+
+    if (byte < 0) // Not there yet, keep what was read so far.
+      return false;
+
+    _buffer[_filled++] = byte;
+  }
+
+  _filled = 0;
+
+  return true;
+}
+
+void ps::ScenePlayer::_fetch(void) {
+  using namespace ps;
+
+  if (_bytes == nullptr or not _is_valid)
+    return;
+
+  if (not _has_header) {
+    if (not _read(format::HEADER_SIZE))
+      return;
+
+    _is_valid = _buffer[0] == format::MAGIC_0 and
+                _buffer[1] == format::MAGIC_1 and
+                _buffer[2] == format::VERSION;
+    _has_header = _is_valid;
+
+    if (not _is_valid)
+      return;
+  }
+
+  if (not _read(format::RECORD_SIZE))
+    return;
+
+  if (_buffer[3] > (unsigned char)Profile::SCURVE) {
+    _is_valid = false;
+    return;
+  }
+
+  _ahead.pos = _buffer[0];
+  _ahead.delay = _buffer[1] | (unsigned short)_buffer[2] << 8;
+  _ahead.profile = (Profile)_buffer[3];
+  _has_ahead = true;
+}
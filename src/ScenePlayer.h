@@ -0,0 +1,170 @@
+#pragma once
+
+#include "PServo.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+namespace ps {
+/*!
+ * Layout of a binary scene: a 4 bytes header followed by one 4 bytes record
+ * per action, with no count, so a scene can be streamed without knowing its
+ * length beforehand.
+ *
+ * | Offset | Header                | Record                          |
+ * | ------ | --------------------- | ------------------------------- |
+ * | 0      | `'P'`                 | Target position                 |
+ * | 1      | `'S'`                 | Delay (or duration), low byte   |
+ * | 2      | `ps::format::VERSION` | Delay (or duration), high byte  |
+ * | 3      | Reserved, `0`         | `ps::Profile` value             |
+ *
+ * @see ps::ScenePlayer
+ */
+namespace format {
+unsigned char constexpr MAGIC_0 = 'P';   //!< First byte of the header.
+unsigned char constexpr MAGIC_1 = 'S';   //!< Second byte of the header.
+unsigned char constexpr VERSION = 1;     //!< Current version of the format.
+unsigned char constexpr HEADER_SIZE = 4; //!< Size of the header, in bytes.
+unsigned char constexpr RECORD_SIZE = 4; //!< Size of each action, in bytes.
+}; // namespace format
+
+/*!
+ * Anything that gives bytes one at a time, like a buffer or the serial port.
+ */
+class ByteSource {
+public:
+  /*!
+   * @returns The next byte, or `-1` when there is no byte available (yet).
+   */
+  virtual int read(void) = 0;
+
+  /*!
+   * Goes back to the first byte.
+   *
+   * @returns `false` when the source can't start over.
+   */
+  virtual bool rewind(void) { return false; }
+};
+
+/*!
+ * Bytes stored in a RAM buffer. The buffer is **not** copied.
+ */
+class MemorySource : public ByteSource {
+public:
+  /*!
+   * @param data Buffer with the bytes.
+   * @param size How much bytes there are in the buffer.
+   */
+  MemorySource(unsigned char const *const data, unsigned long const size);
+
+  int read(void) override;
+  bool rewind(void) override;
+
+protected:
+  unsigned char const *const _data = nullptr;
+  unsigned long const _size = 0;
+  unsigned long _at = 0;
+};
+
+/*!
+ * Same as `ps::MemorySource`, but for a buffer stored in the flash memory of
+ * an AVR board, with the `PROGMEM` attribute. On any other target, it's just a
+ * `ps::MemorySource`.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned char const scene_bin[] PROGMEM = {'P', 'S', 1, 0, 90, 10, 0, 0};
+ *
+ * ps::ProgmemSource bytes(scene_bin, sizeof(scene_bin));
+ * ```
+ */
+class ProgmemSource : public MemorySource {
+public:
+  using MemorySource::MemorySource;
+
+  int read(void) override;
+};
+
+#if defined(ARDUINO)
+/*!
+ * Bytes received from an Arduino `Stream`, like the `Serial` port. It can't be
+ * rewound, so a resetable machine just halts at the end of the stream.
+ */
+class StreamSource : public ByteSource {
+public:
+  /*!
+   * @param stream The stream to read from, like `Serial`.
+   */
+  StreamSource(Stream &stream) : _stream(stream) {}
+
+  int read(void) override { return _stream.read(); }
+
+private:
+  Stream &_stream;
+};
+#endif
+
+/*!
+ * Decodes a binary scene (see `ps::format`) from a byte source, one action
+ * ahead of the machine, so the memory use is the same no matter how long the
+ * scene is. The next action is already decoded when the current one is done,
+ * and a record that arrives in parts (like from the serial port) is kept until
+ * it's completed.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned char const scene_bin[] PROGMEM = {
+ *     'P', 'S', 1, 0,  // Header.
+ *     90, 10, 0, 0,    // {90, 10}
+ *     180, 0xDC, 5, 3, // {180, 1500, ps::Profile::SCURVE}
+ * };
+ *
+ * ps::ProgmemSource bytes(scene_bin, sizeof(scene_bin));
+ * ps::ScenePlayer player(&bytes);
+ *
+ * void setup() {
+ *   myservo_machine.play(&player);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   myservo.write(myservo_machine.pos());
+ *   myservo_machine.tick();
+ * }
+ * ```
+ *
+ * @see ps::PServo::play()
+ */
+class ScenePlayer : public ActionSource {
+public:
+  /*!
+   * @param bytes Where the binary scene will be read from.
+   */
+  ScenePlayer(ByteSource *const bytes);
+
+  bool next(Action *const action) override;
+  bool rewind(void) override;
+  bool peek(Action *const action) override;
+
+  /*!
+   * @returns `false` if the header or a record was not valid, the player stops
+   * giving actions after that.
+   */
+  bool is_valid(void) const;
+
+private:
+  ByteSource *const _bytes = nullptr;
+
+  unsigned char _buffer[format::RECORD_SIZE];
+  unsigned char _filled = 0;
+  bool _has_header = false;
+  bool _has_ahead = false;
+  bool _is_valid = true;
+  Action _ahead = {};
+
+  bool _read(unsigned char const size);
+  void _fetch(void);
+};
+}; // namespace ps
@@ -0,0 +1,226 @@
+#pragma once
+
+#include "PServo.h"
+
+namespace ps {
+/*!
+ * Event driven alternative to calling `ps::PServo::tick()` on every machine in
+ * every `loop()` iteration. It keeps a min-heap with the next deadline of each
+ * registered machine (see `ps::PServo::due()`), so it only updates the ones
+ * that are due, and it can tell how much time there is until the next one --
+ * the sketch can do other work, or sleep, until then.
+ *
+ * Only machines running a compiled scene (`ps::PServo::load()`) can be
+ * scheduled. Machines that halts, or ends up in an error state, are dropped
+ * from the scheduler, call `Scheduler::add()` again after a
+ * `ps::PServo::reset()` to put it back.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned long timer = 0;
+ *
+ * ps::PServo machines[] = {ps::PServo(&timer, true), ps::PServo(&timer, true)};
+ * ps::Scheduler<2> scheduler(&timer);
+ *
+ * void setup() {
+ *   machines[0].load(wave, 2);
+ *   machines[1].load(nod, 3);
+ *
+ *   scheduler.add(&machines[0]);
+ *   scheduler.add(&machines[1]);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   if (scheduler.run() > 0) {
+ *     // Write the new positions...
+ *   }
+ *
+ *   // Do other work for `scheduler.until_next()` milliseconds...
+ * }
+ * ```
+ *
+ * @see ps::PServo
+ */
+template <unsigned short N> class Scheduler {
+public:
+  /*!
+   * Value of `Scheduler::until_next()` when there is nothing scheduled.
+   */
+  static unsigned long constexpr NEVER = ~0ul;
+
+  /*!
+   * @param timer Pointer to the same timer variable used by the machines.
+   */
+  Scheduler(unsigned long *const timer) : _timer(timer) {}
+
+  /*!
+   * @param clock The same clock used by the machines.
+   */
+  Scheduler(Clock const &clock) : _clock(&clock) {}
+
+  /*!
+   * Registers a machine, it will be updated when its next deadline comes. The
+   * same machine should not be added twice while it's still scheduled.
+   *
+   * @param machine Machine running a compiled scene.
+   *
+   * @returns `false` when the scheduler is full or the machine has nothing to
+   * do, `true` otherwise.
+   */
+  bool add(PServo *const machine) {
+    if (_count >= N or not _is_schedulable(machine))
+      return false;
+
+    _push(machine, machine->due());
+
+    return true;
+  }
+
+  /*!
+   * Ticks every machine whose deadline has come, then schedules them again
+   * with their next deadline. Each machine is updated, at most, once per call.
+   *
+   * Since this function is asynchronous, it **should be called every time in
+   * the `loop()` function**!
+   *
+   * @returns How much machines were updated.
+   */
+  unsigned short run(void) {
+    if (not _has_time())
+      return 0;
+
+    unsigned long const now = _now();
+    unsigned short ticked = 0;
+
+    while (_count > 0 and _is_before_or_at(_deadline[0], now)) {
+      PServo *const machine = _machines[0];
+
+      _pop();
+      machine->tick();
+      ++ticked;
+
+      if (not _is_schedulable(machine))
+        continue;
+
+      unsigned long const due = machine->due();
+
+      _push(machine, _is_before_or_at(due, now) ? now + 1 : due);
+    }
+
+    return ticked;
+  }
+
+  /*!
+   * @returns How much time units there is until the next machine is due, `0`
+   * if there is one due right now, or `Scheduler::NEVER` if nothing is
+   * scheduled.
+   */
+  unsigned long until_next(void) const {
+    if (_count < 1)
+      return NEVER;
+
+    if (not _has_time())
+      return 0;
+
+    unsigned long const now = _now();
+
+    if (_is_before_or_at(_deadline[0], now))
+      return 0;
+
+    return elapsed(now, _deadline[0]);
+  }
+
+  /*!
+   * @returns How much machines are scheduled right now.
+   */
+  unsigned short size(void) const { return _count; }
+
+private:
+  unsigned long *const _timer = nullptr;
+  Clock const *const _clock = nullptr;
+
+  PServo *_machines[N] = {};
+  unsigned long _deadline[N] = {};
+  unsigned short _count = 0;
+
+  bool _has_time(void) const { return _clock != nullptr or _timer != nullptr; }
+
+  unsigned long _now(void) const {
+    return _clock != nullptr ? _clock->now() : *_timer;
+  }
+
+  static bool _is_schedulable(PServo const *const machine) {
+    return machine != nullptr and
+           (machine->is_state(State::IN_ACTION) or
+            machine->is_state(State::STANDBY) or
+            machine->is_state(State::INITIALIZED)) and
+           machine->has_scene();
+  }
+
+  // Overflow safe comparison, as long as both are less than half the range of
+  // a 32 bits timer apart (see `ps::elapsed()`).
+  static bool _is_before_or_at(unsigned long const a, unsigned long const b) {
+    return (int32_t)elapsed(b, a) <= 0;
+  }
+
+  static bool _is_before(unsigned long const a, unsigned long const b) {
+    return (int32_t)elapsed(b, a) < 0;
+  }
+
+  void _swap(unsigned short const a, unsigned short const b) {
+    PServo *const machine = _machines[a];
+    unsigned long const deadline = _deadline[a];
+
+    _machines[a] = _machines[b];
+    _deadline[a] = _deadline[b];
+    _machines[b] = machine;
+    _deadline[b] = deadline;
+  }
+
+  void _push(PServo *const machine, unsigned long const deadline) {
+    unsigned short i = _count++;
+
+    _machines[i] = machine;
+    _deadline[i] = deadline;
+
+    // The `i < N` is always true, but the compiler can't tell it on its own.
+    while (i > 0 and i < N) {
+      unsigned short const parent = (i - 1) / 2;
+
+      if (not _is_before(_deadline[i], _deadline[parent]))
+        break;
+
+      _swap(i, parent);
+      i = parent;
+    }
+  }
+
+  void _pop(void) {
+    _swap(0, --_count);
+
+    for (unsigned short i = 0;;) {
+      unsigned short const left = 2 * i + 1;
+      unsigned short const right = left + 1;
+      unsigned short first = i;
+
+      if (left < _count and left < N and
+          _is_before(_deadline[left], _deadline[first]))
+        first = left;
+
+      if (right < _count and right < N and
+          _is_before(_deadline[right], _deadline[first]))
+        first = right;
+
+      if (first == i)
+        break;
+
+      _swap(i, first);
+      i = first;
+    }
+  }
+};
+
+template <unsigned short N> unsigned long constexpr Scheduler<N>::NEVER;
+}; // namespace ps
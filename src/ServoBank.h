@@ -0,0 +1,287 @@
+#pragma once
+
+#include "Kernel.h"
+#include "PServo.h"
+
+namespace ps {
+/*!
+ * A fixed size collection of state machines that behaves just like `N`
+ * `ps::PServo` objects running compiled scenes (see `ps::PServo::load()`),
+ * but stores each property in its own contiguous array instead of one object
+ * per servo. A single `ServoBank::tick()` call advances all of them in one
+ * tight loop, without chasing pointers through scattered objects, and the
+ * position stepping is done by the vectorized `ps::kernel::step()`.
+ *
+ * All machines of a bank share the same timer variable, and only the
+ * `ps::Profile::STEP` actions are supported -- the profile of each action is
+ * ignored.
+ *
+ * For an example:
+ * ```cpp
+ * unsigned long timer = 0;
+ *
+ * ps::Action const wave[] = {{180, 10}, {0, 10}};
+ * ps::Action const nod[] = {{90, 20}, {45, 20}};
+ *
+ * ps::ServoBank<2> bank(&timer);
+ * Servo servos[2];
+ *
+ * void setup() {
+ *   bank.load(0, wave, 2);
+ *   bank.load(1, nod, 2);
+ * }
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   bank.tick();
+ *
+ *   for (unsigned short i = 0; i < 2; ++i)
+ *     servos[i].write(bank.pos(i));
+ * }
+ * ```
+ *
+ * @see ps::PServo
+ * @see ps::Action
+ */
+template <unsigned short N> class ServoBank {
+public:
+  /*!
+   * Every machine starts with the `ps::Default` limits, not resetable, and
+   * with no actions (`ps::State::STANDBY`).
+   *
+   * @param timer Pointer to a timer variable, normally related to the
+   * `millis()` function.
+   */
+  ServoBank(unsigned long *const timer) : _timer(timer) {
+    for (unsigned short i = 0; i < N; ++i) {
+      _state[i] = State::STANDBY;
+      _pc[i] = 0;
+      _pos[i] = 0;
+      _target[i] = 0;
+      _min[i] = Default::MIN;
+      _max[i] = Default::MAX;
+      _delay[i] = Default::DELAY;
+      _active_action[i] = 0;
+      _actions_count[i] = 0;
+      _is_resetable[i] = false;
+      _arrived[i] = 0x00;
+      _go[i] = 0x00;
+      _actions[i] = nullptr;
+    }
+  }
+
+  /*!
+   * Same as the `ps::PServo` constructor options, configures the limits and
+   * the reset setting of a single machine.
+   *
+   * @param i Index of the machine inside the bank.
+   * @param min Minimul position value that this machine can be.
+   * @param max Maximum position value that this machine can be.
+   * @param is_resetable Configure the machine to reset after it's halted.
+   */
+  void configure(unsigned short const i, unsigned char const min,
+                 unsigned char const max, bool const is_resetable) {
+    _min[i] = min;
+    _max[i] = max;
+    _is_resetable[i] = is_resetable;
+  }
+
+  /*!
+   * Registers a compiled scene to a single machine, it works exactly like the
+   * `ps::PServo::load()` method. The table is **not** copied.
+   *
+   * @param i Index of the machine inside the bank.
+   * @param actions Table with each action that this machine should perform.
+   * @param actions_count How much actions there are in the `actions` table.
+   */
+  void load(unsigned short const i, Action const *const actions,
+            unsigned char const actions_count) {
+    _actions[i] = actions;
+    _actions_count[i] = actions == nullptr ? 0 : actions_count;
+
+    _start(i);
+  }
+
+  /*!
+   * Advances every machine of the bank by one loop iteration, same as calling
+   * `ps::PServo::tick()` on each one of them.
+   */
+  void tick(void) {
+    if (_timer == nullptr) {
+      for (unsigned short i = 0; i < N; ++i)
+        _state[i] = _state[i] == State::IN_ACTION ? State::ERROR_TIMERPTR
+                                                  : _state[i];
+      return;
+    }
+
+    unsigned long const now = *_timer;
+
+    // First passes are branchless: check which machines are due and flag the
+    // ones that already got to their target, then step all of them with the
+    // vectorized kernel.
+    for (unsigned short i = 0; i < N; ++i) {
+      bool const is_running = _state[i] == State::IN_ACTION;
+
+      _arrived[i] = is_running and _pos[i] == _target[i] ? 0xFF : 0x00;
+      _go[i] = is_running and elapsed(_pc[i], now) >= _delay[i] ? 0xFF : 0x00;
+    }
+
+    kernel::step(_pos, _target, _min, _max, _go, N);
+
+    for (unsigned short i = 0; i < N; ++i)
+      _pc[i] = _go[i] ? now : _pc[i];
+
+    // Second pass, only for the few machines that need to start a new action.
+    for (unsigned short i = 0; i < N; ++i) {
+      if (_arrived[i])
+        _advance(i, now);
+    }
+  }
+
+  /*!
+   * Same as `ps::PServo::reset()`, but the machine is ready to start over on
+   * the next `tick()` right away, since the scene is already counted.
+   *
+   * @param i Index of the machine inside the bank.
+   */
+  void reset(unsigned short const i) {
+    if (_state[i] != State::HALT)
+      return;
+
+    _start(i);
+  }
+
+  /*!
+   * @param i Index of the machine inside the bank.
+   *
+   * @returns The current registered postion of that machine.
+   */
+  unsigned char pos(unsigned short const i) const { return _pos[i]; }
+
+  /*!
+   * @param i Index of the machine inside the bank.
+   *
+   * @returns The current state of that machine.
+   */
+  State get_state(unsigned short const i) const { return _state[i]; }
+
+  /*!
+   * @param i Index of the machine inside the bank.
+   * @param s State to compare to.
+   *
+   * @returns Is that machine in the specified state?
+   */
+  bool is_state(unsigned short const i, State const s) const {
+    return _state[i] == s;
+  }
+
+  /*!
+   * Builds the same `ps::Props` view that a `ps::PServo` object would give,
+   * for a single machine of the bank.
+   *
+   * @param i Index of the machine inside the bank.
+   *
+   * @returns A `ps::Props` struct with the values of that machine.
+   */
+  Props const props(unsigned short const i) const {
+    return Props{
+        .state = _state[i],
+        .pc = _pc[i],
+        .timer = _timer,
+        .clock = nullptr,
+        .min = _min[i],
+        .max = _max[i],
+        .is_resetable = _is_resetable[i],
+        .curr_action = _active_action[i],
+        .active_action = _active_action[i],
+        .actions_count = _actions_count[i],
+        .pos = _pos[i],
+        .delay = (unsigned short)(_delay[i] < Default::DELAY ? Default::DELAY
+                                                             : _delay[i]),
+        .actions = _actions[i],
+        .is_catching_up = false,
+        .is_high_res = false,
+        .frac = 0,
+        .source = nullptr,
+        .profile = nullptr,
+        .is_looking_ahead = false,
+        .tolerance = 0,
+#if defined(PS_INSTRUMENT)
+        .stats = {},
+#endif
+    };
+  }
+
+  /*!
+   * @returns How much machines this bank holds.
+   */
+  unsigned short size(void) const { return N; }
+
+private:
+  unsigned long *const _timer = nullptr;
+
+  State _state[N];
+  unsigned long _pc[N];
+  unsigned char _pos[N];
+  unsigned char _target[N];
+  unsigned char _min[N];
+  unsigned char _max[N];
+  unsigned short _delay[N];
+  unsigned char _active_action[N];
+  unsigned char _actions_count[N];
+  bool _is_resetable[N];
+  unsigned char _arrived[N];
+  unsigned char _go[N];
+  Action const *_actions[N];
+
+  void _start(unsigned short const i) {
+    if (_actions_count[i] < 1) {
+      _state[i] = State::ERROR_NOACTION;
+      return;
+    }
+
+    _state[i] = State::IN_ACTION;
+    _active_action[i] = 0;
+    _select(i);
+  }
+
+  inline void _select(unsigned short const i) {
+    _target[i] = _actions[i][_active_action[i]].pos;
+    _delay[i] = _actions[i][_active_action[i]].delay;
+  }
+
+  /*!
+   * Starts the next action, then keeps stepping in the same loop iteration as
+   * long as the actions are already completed, just like `ps::PServo::tick()`.
+   */
+  void _advance(unsigned short const i, unsigned long const now) {
+    for (;;) {
+      if (++_active_action[i] >= _actions_count[i]) {
+        if (_is_resetable[i]) {
+          _active_action[i] = 0;
+          _select(i);
+        } else {
+          _state[i] = State::HALT;
+        }
+
+        return;
+      }
+
+      _select(i);
+
+      if (_pos[i] != _target[i]) {
+        if (elapsed(_pc[i], now) >= _delay[i]) {
+          _pc[i] = now;
+          _pos[i] = _pos[i] < _target[i] ? _pos[i] + 1 : _pos[i] - 1;
+          _pos[i] = _pos[i] < _min[i]   ? _min[i]
+                    : _pos[i] > _max[i] ? _max[i]
+                                        : _pos[i];
+        }
+
+        return;
+      }
+    }
+  }
+};
+}; // namespace ps
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "PServo.h"
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+namespace ps {
+/*!
+ * Layout of a binary trace: a 4 bytes header followed by one 8 bytes record
+ * per sample, with no count, so a trace can be sent in parts while the
+ * machines are still running. Multi-byte values are little endian.
+ *
+ * | Offset | Header               | Record                          |
+ * | ------ | -------------------- | ------------------------------- |
+ * | 0      | `'P'`                | Timestamp, lowest byte          |
+ * | 1      | `'T'`                | Timestamp                       |
+ * | 2      | `ps::trace::VERSION` | Timestamp                       |
+ * | 3      | Reserved, `0`        | Timestamp, highest byte         |
+ * | 4      |                      | Machine id                      |
+ * | 5      |                      | Position                        |
+ * | 6      |                      | `ps::State` value               |
+ * | 7      |                      | Active action                   |
+ *
+ * @see ps::Trace
+ */
+namespace trace {
+unsigned char constexpr MAGIC_0 = 'P';   //!< First byte of the header.
+unsigned char constexpr MAGIC_1 = 'T';   //!< Second byte of the header.
+unsigned char constexpr VERSION = 1;     //!< Current version of the format.
+unsigned char constexpr HEADER_SIZE = 4; //!< Size of the header, in bytes.
+unsigned char constexpr RECORD_SIZE = 8; //!< Size of each sample, in bytes.
+
+/*!
+ * A single decoded sample of a trace.
+ */
+typedef struct Record {
+  uint32_t time;        //!< Timer value when it was recorded.
+  unsigned char id;     //!< Which machine it was, given by the sketch.
+  unsigned char pos;    //!< Position of the machine.
+  State state;          //!< State of the machine.
+  unsigned char action; //!< Active action of the machine.
+} Record;
+}; // namespace trace
+
+/*!
+ * Anything that takes bytes in bulk, like a buffer or the serial port.
+ */
+class ByteSink {
+public:
+  /*!
+   * @param data Bytes to be written.
+   * @param size How much bytes there are.
+   *
+   * @returns How much bytes were taken, it may be less than `size` (even `0`)
+   * when the sink has no room for them right now.
+   */
+  virtual unsigned short write(unsigned char const *const data,
+                               unsigned short const size) = 0;
+};
+
+#if defined(ARDUINO)
+/*!
+ * Bytes sent to an Arduino `Stream`, like the `Serial` port. It never waits,
+ * only what fits in the transmit buffer (see `availableForWrite()`) is taken.
+ */
+class StreamSink : public ByteSink {
+public:
+  /*!
+   * @param stream The stream to write to, like `Serial`.
+   */
+  StreamSink(Stream &stream) : _stream(stream) {}
+
+  unsigned short write(unsigned char const *const data,
+                       unsigned short const size) override {
+    int const room = _stream.availableForWrite();
+
+    if (room <= 0)
+      return 0;
+
+    return _stream.write(data, (unsigned short)room < size ? room : size);
+  }
+
+private:
+  Stream &_stream;
+};
+#endif
+
+/*!
+ * Low overhead recorder of what the machines are doing. Each sample is copied
+ * to a RAM ring buffer as a fixed size binary record (see `ps::trace`), so it's
+ * cheap enough to be called on every loop iteration. The records are sent in
+ * bulk by `Trace::flush()`, as much as the sink takes, and decoded on the host
+ * with the `trace` tool -- as CSV or as a timeline of each machine.
+ *
+ * When the buffer is full, the new samples are dropped (and counted), the ones
+ * already recorded are never overwritten.
+ *
+ * For an example:
+ * ```cpp
+ * ps::Trace<32> trace; // 256 bytes of RAM.
+ * ps::StreamSink serial(Serial);
+ *
+ * void loop() {
+ *   timer = millis();
+ *
+ *   myservo_machine.tick();
+ *   trace.record(timer, 0, myservo_machine);
+ *
+ *   trace.flush(serial);
+ * }
+ * ```
+ *
+ * @tparam N How much records it can hold, a power of 2, up to 128.
+ *
+ * @see ps::trace
+ * @see ps::ByteSink
+ */
+template <unsigned char N> class Trace {
+  static_assert(N > 0 and N <= 128 and (N & (N - 1)) == 0,
+                "The trace capacity should be a power of 2, up to 128.");
+
+public:
+  /*!
+   * Records the current values of a machine.
+   *
+   * @param time Current value of the timer.
+   * @param id Number that tells the machines apart, chosen by the sketch.
+   * @param machine The machine to be recorded.
+   *
+   * @returns `false` if the buffer is full and the sample was dropped.
+   */
+  bool record(unsigned long const time, unsigned char const id,
+              PServo const &machine) {
+    return record(time, id, machine.pos(), machine.get_state(),
+                  machine.active_action());
+  }
+
+  /*!
+   * Same as the other `Trace::record()`, but with the values given one by one,
+   * for anything that isn't a `ps::PServo`.
+   *
+   * @param time Current value of the timer.
+   * @param id Number that tells the machines apart, chosen by the sketch.
+   * @param pos Position of the machine.
+   * @param state State of the machine.
+   * @param action Active action of the machine.
+   *
+   * @returns `false` if the buffer is full and the sample was dropped.
+   */
+  bool record(unsigned long const time, unsigned char const id,
+              unsigned char const pos, State const state,
+              unsigned char const action) {
+    if ((unsigned char)(_head - _tail) >= N) {
+      ++_dropped;
+      return false;
+    }
+
+    unsigned char *const bytes =
+        _bytes + (_head & (N - 1)) * trace::RECORD_SIZE;
+
+    bytes[0] = time & 0xFF;
+    bytes[1] = (time >> 8) & 0xFF;
+    bytes[2] = (time >> 16) & 0xFF;
+    bytes[3] = (time >> 24) & 0xFF;
+    bytes[4] = id;
+    bytes[5] = pos;
+    bytes[6] = (unsigned char)state;
+    bytes[7] = action;
+
+    ++_head;
+
+    return true;
+  }
+
+  /*!
+   * Sends the header (once) and the recorded samples, in as few writes as
+   * possible. It stops when the sink doesn't take any more bytes, and a record
+   * that was sent in parts is continued on the next call.
+   *
+   * @param sink Where the bytes should be written to.
+   *
+   * @returns How much bytes were written.
+   */
+  unsigned short flush(ByteSink &sink) {
+    unsigned short written = 0;
+
+    while (_header_sent < trace::HEADER_SIZE) {
+      unsigned char const header[] = {trace::MAGIC_0, trace::MAGIC_1,
+                                      trace::VERSION, 0};
+      unsigned short const taken = sink.write(
+          header + _header_sent, trace::HEADER_SIZE - _header_sent);
+
+      if (taken == 0)
+        return written;
+
+      _header_sent += taken;
+      written += taken;
+    }
+
+    while (_head != _tail) {
+      unsigned char const first = _tail & (N - 1);
+      unsigned char const waiting = _head - _tail;
+
+      // Up to the end of the buffer, the rest is sent on the next round.
+      unsigned char const records = waiting < N - first ? waiting : N - first;
+      unsigned short const taken =
+          sink.write(_bytes + first * trace::RECORD_SIZE + _sent,
+                     records * trace::RECORD_SIZE - _sent);
+
+      if (taken == 0)
+        break;
+
+      _tail += (_sent + taken) / trace::RECORD_SIZE;
+      _sent = (_sent + taken) % trace::RECORD_SIZE;
+      written += taken;
+    }
+
+    return written;
+  }
+
+  /*!
+   * @returns How much records are waiting to be sent.
+   */
+  unsigned char size(void) const { return _head - _tail; }
+
+  /*!
+   * @returns How much records it can hold.
+   */
+  unsigned char capacity(void) const { return N; }
+
+  /*!
+   * @returns How much samples were dropped because the buffer was full.
+   */
+  unsigned long dropped(void) const { return _dropped; }
+
+private:
+  unsigned char _bytes[N * trace::RECORD_SIZE];
+  unsigned char _head = 0; // Free running, only the low bits are the index.
+  unsigned char _tail = 0;
+  unsigned char _sent = 0; // Bytes of the tail record that were already sent.
+  unsigned char _header_sent = 0;
+  unsigned long _dropped = 0;
+};
+}; // namespace ps